@@ -0,0 +1,21 @@
+/*
+ * types.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TYPES_H__
+#define __TYPES_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*** TYPES structures ***/
+
+// Host stand-in of the MCU standard types header, used by the host benchmark and test targets only.
+typedef char char_t;
+typedef float float32_t;
+typedef double float64_t;
+
+#endif /* __TYPES_H__ */
@@ -0,0 +1,422 @@
+/*
+ * una_bench.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "una.h"
+#include "una_reference.h"
+#include "types.h"
+#ifdef UNA_LIB_USE_TRACE
+#include "una_async.h"
+#include "una_sim.h"
+#include "una_trace.h"
+#endif
+
+/*** BENCH local macros ***/
+
+#define BENCH_SAMPLE_SIZE           (0b1 << 16)
+#define BENCH_ITERATIONS            64
+
+#define BENCH_NS_PER_SECOND         1000000000.0
+
+#define BENCH_CHECK_ERROR_PRINT_MAX 8
+
+#define BENCH_TRACE_BUS_NUMBER      2
+#define BENCH_TRACE_CYCLES          8
+#define BENCH_TRACE_LATENCY_MS      2
+#define BENCH_TRACE_TIMEOUT_MS      10
+
+/*** BENCH local structures ***/
+
+/*******************************************************************/
+typedef void (*BENCH_convert_batch_t)(const int32_t* physical_data, uint32_t* una_representation, uint32_t size);
+
+/*******************************************************************/
+typedef void (*BENCH_get_batch_t)(const uint32_t* una_representation, int32_t* physical_data, uint32_t size);
+
+/*******************************************************************/
+typedef enum {
+    BENCH_DISTRIBUTION_REALISTIC = 0,
+    BENCH_DISTRIBUTION_ADVERSARIAL,
+    BENCH_DISTRIBUTION_LAST
+} BENCH_distribution_t;
+
+/*******************************************************************/
+typedef struct {
+    const char_t* name;
+    uint8_t representation_size_bits;
+    UNA_convert_physical_data_t convert;
+    UNA_get_physical_data_t get;
+    BENCH_convert_batch_t convert_batch;
+    BENCH_get_batch_t get_batch;
+    UNA_convert_physical_data_t convert_reference;
+    UNA_get_physical_data_t get_reference;
+    int32_t realistic_min;
+    int32_t realistic_max;
+} BENCH_codec_t;
+
+/*** BENCH local global variables ***/
+
+static const BENCH_codec_t BENCH_CODEC[] = {
+    { "seconds", 8, &UNA_convert_seconds, &UNA_get_seconds, &UNA_convert_seconds_batch, &UNA_get_seconds_batch, &UNA_REFERENCE_convert_seconds, &UNA_REFERENCE_get_seconds, 0, 604800 },
+    { "year", 8, &UNA_convert_year, &UNA_get_year, NULL, &UNA_get_year_batch, &UNA_REFERENCE_convert_year, &UNA_REFERENCE_get_year, 2020, 2060 },
+    { "tenth_degrees", 12, &UNA_convert_tenth_degrees, &UNA_get_tenth_degrees, NULL, &UNA_get_tenth_degrees_batch, &UNA_REFERENCE_convert_tenth_degrees, &UNA_REFERENCE_get_tenth_degrees, -400, 1250 },
+    { "mv", 16, &UNA_convert_mv, &UNA_get_mv, &UNA_convert_mv_batch, &UNA_get_mv_batch, &UNA_REFERENCE_convert_mv, &UNA_REFERENCE_get_mv, 0, 60000 },
+    { "ua", 16, &UNA_convert_ua, &UNA_get_ua, &UNA_convert_ua_batch, &UNA_get_ua_batch, &UNA_REFERENCE_convert_ua, &UNA_REFERENCE_get_ua, 0, 20000000 },
+    { "mw_mva", 16, &UNA_convert_mw_mva, &UNA_get_mw_mva, &UNA_convert_mw_mva_batch, &UNA_get_mw_mva_batch, &UNA_REFERENCE_convert_mw_mva, &UNA_REFERENCE_get_mw_mva, -5000000, 5000000 },
+    { "mwh_mvah", 16, &UNA_convert_mwh_mvah, &UNA_get_mwh_mvah, &UNA_convert_mwh_mvah_batch, &UNA_get_mwh_mvah_batch, &UNA_REFERENCE_convert_mwh_mvah, &UNA_REFERENCE_get_mwh_mvah, 0, 2000000000 },
+    { "power_factor", 8, &UNA_convert_power_factor, &UNA_get_power_factor, NULL, &UNA_get_power_factor_batch, &UNA_REFERENCE_convert_power_factor, &UNA_REFERENCE_get_power_factor, -100, 100 },
+    { "dbm", 8, &UNA_convert_dbm, &UNA_get_dbm, NULL, &UNA_get_dbm_batch, &UNA_REFERENCE_convert_dbm, &UNA_REFERENCE_get_dbm, -140, 20 },
+};
+
+static const char_t* const BENCH_DISTRIBUTION_NAME[BENCH_DISTRIBUTION_LAST] = { "realistic", "adversarial" };
+
+static int32_t bench_physical_data[BENCH_SAMPLE_SIZE];
+static uint32_t bench_una_representation[BENCH_SAMPLE_SIZE];
+static int32_t bench_physical_data_out[BENCH_SAMPLE_SIZE];
+static uint32_t bench_una_representation_out[BENCH_SAMPLE_SIZE];
+static volatile uint32_t bench_sink = 0;
+
+#ifdef UNA_LIB_USE_TRACE
+static const char_t* const BENCH_TRACE_STAGE_NAME[UNA_TRACE_STAGE_LAST] = { "queue", "tx", "turnaround", "reply", "parse", "decode", "total" };
+static UNA_sim_node_t bench_sim_node_table[UNA_NODE_ADDRESS_LAST];
+static UNA_trace_histogram_t bench_trace_histogram_table[UNA_TRACE_STAGE_LAST];
+static UNA_trace_histogram_t bench_trace_node_histogram_table[UNA_NODE_ADDRESS_LAST * UNA_TRACE_STAGE_LAST];
+#endif
+
+/*** BENCH local functions ***/
+
+/*******************************************************************/
+static float64_t _BENCH_get_time_ns(void) {
+    // Local variables.
+    struct timespec now;
+    // Read monotonic clock.
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (((float64_t) now.tv_sec) * BENCH_NS_PER_SECOND + ((float64_t) now.tv_nsec));
+}
+
+/*******************************************************************/
+static uint64_t _BENCH_get_cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    // Cycle counter not available on this host.
+    return 0;
+#endif
+}
+
+/*******************************************************************/
+static uint32_t _BENCH_random(void) {
+    // Local variables.
+    static uint32_t state = 0x12345678;
+    // Xorshift generator, reproducible between runs.
+    state ^= (state << 13);
+    state ^= (state >> 17);
+    state ^= (state << 5);
+    return state;
+}
+
+/*******************************************************************/
+static void _BENCH_fill_samples(const BENCH_codec_t* codec, BENCH_distribution_t distribution) {
+    // Local variables.
+    uint32_t idx = 0;
+    uint32_t range = 0;
+    int32_t magnitude = 0;
+    for (idx = 0; idx < BENCH_SAMPLE_SIZE; idx++) {
+        if (distribution == BENCH_DISTRIBUTION_REALISTIC) {
+            // Uniform values in the typical range of the quantity.
+            range = (uint32_t) (codec->realistic_max - codec->realistic_min) + 1;
+            bench_physical_data[idx] = codec->realistic_min + (int32_t) (_BENCH_random() % range);
+            bench_una_representation[idx] = (codec->convert)(bench_physical_data[idx]);
+        }
+        else {
+            // Random sign, random unit and values around the unit thresholds to defeat branch prediction.
+            magnitude = (int32_t) ((0b1UL << (_BENCH_random() % 31)) + (_BENCH_random() % 3) - 1);
+            bench_physical_data[idx] = ((_BENCH_random() & 0b1) != 0) ? ((-1) * magnitude) : magnitude;
+            bench_una_representation[idx] = (_BENCH_random() & ((0b1UL << codec->representation_size_bits) - 1));
+        }
+    }
+}
+
+/*******************************************************************/
+static void _BENCH_print(const BENCH_codec_t* codec, const char_t* function, BENCH_distribution_t distribution, float64_t duration_ns, uint64_t cycles) {
+    // Local variables.
+    float64_t ns_per_op = (duration_ns / ((float64_t) BENCH_SAMPLE_SIZE * BENCH_ITERATIONS));
+    float64_t cycles_per_op = (((float64_t) cycles) / ((float64_t) BENCH_SAMPLE_SIZE * BENCH_ITERATIONS));
+    // Print result line.
+    printf("%-14s %-16s %-12s %10.3f ns/op %8.2f cycles/op %14.0f ops/s\n", codec->name, function, BENCH_DISTRIBUTION_NAME[distribution], ns_per_op, cycles_per_op, (BENCH_NS_PER_SECOND / ns_per_op));
+}
+
+/*******************************************************************/
+static void _BENCH_run_codec(const BENCH_codec_t* codec, BENCH_distribution_t distribution) {
+    // Local variables.
+    float64_t start_ns = 0.0;
+    float64_t get_duration_ns = 0.0;
+    float64_t reference_duration_ns = 0.0;
+    uint64_t start_cycles = 0;
+    uint32_t iteration = 0;
+    uint32_t idx = 0;
+    uint32_t accumulator = 0;
+    // Generate inputs.
+    _BENCH_fill_samples(codec, distribution);
+    // Single value encoder.
+    start_cycles = _BENCH_get_cycles();
+    start_ns = _BENCH_get_time_ns();
+    for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++) {
+        for (idx = 0; idx < BENCH_SAMPLE_SIZE; idx++) {
+            accumulator += (codec->convert)(bench_physical_data[idx]);
+        }
+    }
+    _BENCH_print(codec, "convert", distribution, (_BENCH_get_time_ns() - start_ns), (_BENCH_get_cycles() - start_cycles));
+    // Single value decoder.
+    start_cycles = _BENCH_get_cycles();
+    start_ns = _BENCH_get_time_ns();
+    for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++) {
+        for (idx = 0; idx < BENCH_SAMPLE_SIZE; idx++) {
+            accumulator += (uint32_t) (codec->get)(bench_una_representation[idx]);
+        }
+    }
+    get_duration_ns = (_BENCH_get_time_ns() - start_ns);
+    _BENCH_print(codec, "get", distribution, get_duration_ns, (_BENCH_get_cycles() - start_cycles));
+    // Bitfield based reference decoder.
+    if (codec->get_reference != NULL) {
+        start_cycles = _BENCH_get_cycles();
+        start_ns = _BENCH_get_time_ns();
+        for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++) {
+            for (idx = 0; idx < BENCH_SAMPLE_SIZE; idx++) {
+                accumulator += (uint32_t) (codec->get_reference)(bench_una_representation[idx]);
+            }
+        }
+        reference_duration_ns = (_BENCH_get_time_ns() - start_ns);
+        _BENCH_print(codec, "get_bitfield", distribution, reference_duration_ns, (_BENCH_get_cycles() - start_cycles));
+        printf("%-14s %-16s %-12s %10.2f x\n", codec->name, "get_speedup", BENCH_DISTRIBUTION_NAME[distribution], (reference_duration_ns / get_duration_ns));
+    }
+    // Division based reference encoder.
+    if (codec->convert_reference != NULL) {
+        start_cycles = _BENCH_get_cycles();
+        start_ns = _BENCH_get_time_ns();
+        for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++) {
+            for (idx = 0; idx < BENCH_SAMPLE_SIZE; idx++) {
+                accumulator += (codec->convert_reference)(bench_physical_data[idx]);
+            }
+        }
+        _BENCH_print(codec, "convert_division", distribution, (_BENCH_get_time_ns() - start_ns), (_BENCH_get_cycles() - start_cycles));
+    }
+    // Batch encoder.
+    if (codec->convert_batch != NULL) {
+        start_cycles = _BENCH_get_cycles();
+        start_ns = _BENCH_get_time_ns();
+        for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++) {
+            (codec->convert_batch)(bench_physical_data, bench_una_representation_out, BENCH_SAMPLE_SIZE);
+            accumulator += bench_una_representation_out[iteration];
+        }
+        _BENCH_print(codec, "convert_batch", distribution, (_BENCH_get_time_ns() - start_ns), (_BENCH_get_cycles() - start_cycles));
+    }
+    // Batch decoder.
+    if (codec->get_batch != NULL) {
+        start_cycles = _BENCH_get_cycles();
+        start_ns = _BENCH_get_time_ns();
+        for (iteration = 0; iteration < BENCH_ITERATIONS; iteration++) {
+            (codec->get_batch)(bench_una_representation, bench_physical_data_out, BENCH_SAMPLE_SIZE);
+            accumulator += (uint32_t) bench_physical_data_out[iteration];
+        }
+        _BENCH_print(codec, "get_batch", distribution, (_BENCH_get_time_ns() - start_ns), (_BENCH_get_cycles() - start_cycles));
+    }
+    bench_sink += accumulator;
+}
+
+/*******************************************************************/
+static uint32_t _BENCH_check_codec(const BENCH_codec_t* codec) {
+    // Local variables.
+    uint32_t error_count = 0;
+    uint32_t una_representation = 0;
+    uint32_t una_representation_max = (0b1UL << codec->representation_size_bits);
+    int32_t physical_data = 0;
+    uint32_t idx = 0;
+    BENCH_distribution_t distribution = 0;
+    // Exhaustive check over the full representation width.
+    for (una_representation = 0; una_representation < una_representation_max; una_representation++) {
+        // Decoder must match the original function.
+        physical_data = (codec->get)(una_representation);
+        if (physical_data != (codec->get_reference)(una_representation)) {
+            if (error_count < BENCH_CHECK_ERROR_PRINT_MAX) {
+                printf("%s: decoder error on representation 0x%X (%d instead of %d)\n", codec->name, una_representation, physical_data, (codec->get_reference)(una_representation));
+            }
+            error_count++;
+        }
+        // Encoder must match the original function on all decoded values.
+        if ((codec->convert)(physical_data) != (codec->convert_reference)(physical_data)) {
+            if (error_count < BENCH_CHECK_ERROR_PRINT_MAX) {
+                printf("%s: encoder error on value %d\n", codec->name, physical_data);
+            }
+            error_count++;
+        }
+        // Batch decoder must match the single value function.
+        if (codec->get_batch != NULL) {
+            (codec->get_batch)(&una_representation, &physical_data, 1);
+            if (physical_data != (codec->get)(una_representation)) {
+                if (error_count < BENCH_CHECK_ERROR_PRINT_MAX) {
+                    printf("%s: batch decoder error on representation 0x%X\n", codec->name, una_representation);
+                }
+                error_count++;
+            }
+        }
+    }
+    // Encoders must match the original function on both input distributions.
+    for (distribution = 0; distribution < BENCH_DISTRIBUTION_LAST; distribution++) {
+        _BENCH_fill_samples(codec, distribution);
+        if (codec->convert_batch != NULL) {
+            (codec->convert_batch)(bench_physical_data, bench_una_representation_out, BENCH_SAMPLE_SIZE);
+        }
+        for (idx = 0; idx < BENCH_SAMPLE_SIZE; idx++) {
+            if ((codec->convert)(bench_physical_data[idx]) != (codec->convert_reference)(bench_physical_data[idx])) {
+                if (error_count < BENCH_CHECK_ERROR_PRINT_MAX) {
+                    printf("%s: encoder error on value %d\n", codec->name, bench_physical_data[idx]);
+                }
+                error_count++;
+            }
+            // Batch encoder must match the single value function.
+            if ((codec->convert_batch != NULL) && (bench_una_representation_out[idx] != (codec->convert)(bench_physical_data[idx]))) {
+                if (error_count < BENCH_CHECK_ERROR_PRINT_MAX) {
+                    printf("%s: batch encoder error on value %d\n", codec->name, bench_physical_data[idx]);
+                }
+                error_count++;
+            }
+        }
+    }
+    return error_count;
+}
+
+#ifdef UNA_LIB_USE_TRACE
+/*******************************************************************/
+static uint32_t _BENCH_get_trace_timestamp_us(void) {
+    return ((uint32_t) (_BENCH_get_time_ns() / 1000.0));
+}
+
+/*******************************************************************/
+static void _BENCH_trace_completion_callback(UNA_access_parameters_t* access_params, uint32_t reg_value, UNA_access_status_t access_status, void* context) {
+    // Local variables.
+    uint32_t trace_timestamp = 0;
+    // Decode stage is traced by the application.
+    if (access_status.flags == 0) {
+        UNA_TRACE_START(trace_timestamp);
+        bench_sink += (uint32_t) UNA_get_mv(reg_value & 0xFFFF);
+        UNA_TRACE_STOP(UNA_TRACE_STAGE_DECODE, access_params->node_addr, trace_timestamp);
+    }
+    (*((uint32_t*) context))++;
+}
+
+/*******************************************************************/
+static void _BENCH_print_trace_summary(const char_t* name, UNA_trace_summary_t* summary) {
+    printf("%-12s %10u %10u %10u %10u\n", name, summary->count, summary->p50, summary->p99, summary->max);
+}
+
+/*******************************************************************/
+static int _BENCH_run_trace(void) {
+    // Local variables.
+    UNA_async_transaction_t transaction_table[BENCH_TRACE_BUS_NUMBER];
+    UNA_async_bus_t bus_table[BENCH_TRACE_BUS_NUMBER];
+    UNA_async_t engine;
+    UNA_access_parameters_t access_params;
+    UNA_trace_summary_t summary;
+    char_t node_name[8];
+    uint32_t start_time_us = 0;
+    uint32_t now_ms = 0;
+    uint32_t completed_count = 0;
+    uint32_t submitted_count = 0;
+    uint32_t cycle_idx = 0;
+    uint8_t node_addr = 0;
+    uint8_t stage = 0;
+    // Simulated bus, with real time replies latency.
+    if ((UNA_SIM_init(bench_sim_node_table, 1) != UNA_SIM_SUCCESS) || (UNA_SIM_populate(2, BENCH_TRACE_BUS_NUMBER, BENCH_TRACE_LATENCY_MS) != UNA_SIM_SUCCESS)) {
+        return EXIT_FAILURE;
+    }
+    if (UNA_ASYNC_init(&engine, &UNA_SIM_ASYNC_TRANSPORT, transaction_table, BENCH_TRACE_BUS_NUMBER, bus_table, BENCH_TRACE_BUS_NUMBER, 1000) != UNA_ASYNC_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    if (UNA_TRACE_init(&_BENCH_get_trace_timestamp_us, bench_trace_histogram_table, bench_trace_node_histogram_table) != UNA_TRACE_SUCCESS) {
+        return EXIT_FAILURE;
+    }
+    start_time_us = _BENCH_get_trace_timestamp_us();
+    access_params.reg_addr = UNA_SIM_REGISTER_ANALOG_DATA_0;
+    access_params.reply_params.type = UNA_REPLY_TYPE_VALUE;
+    access_params.reply_params.timeout_ms = BENCH_TRACE_TIMEOUT_MS;
+    // Poll all present nodes on their own bus segment.
+    for (cycle_idx = 0; cycle_idx < BENCH_TRACE_CYCLES; cycle_idx++) {
+        for (node_addr = 1; node_addr < UNA_NODE_ADDRESS_LAST; node_addr++) {
+            if (bench_sim_node_table[node_addr].board_id >= UNA_BOARD_ID_LAST) {
+                continue;
+            }
+            access_params.node_addr = (UNA_node_address_t) node_addr;
+            while (UNA_ASYNC_submit(&engine, bench_sim_node_table[node_addr].bus_index, UNA_ACCESS_TYPE_READ, &access_params, 0, 0, &_BENCH_trace_completion_callback, &completed_count, now_ms) == UNA_ASYNC_ERROR_POOL_FULL) {
+                now_ms = ((_BENCH_get_trace_timestamp_us() - start_time_us) / 1000);
+                UNA_SIM_set_time_ms(now_ms);
+                UNA_ASYNC_process(&engine, now_ms);
+            }
+            submitted_count++;
+        }
+    }
+    while (completed_count < submitted_count) {
+        now_ms = ((_BENCH_get_trace_timestamp_us() - start_time_us) / 1000);
+        UNA_SIM_set_time_ms(now_ms);
+        UNA_ASYNC_process(&engine, now_ms);
+    }
+    // Dump stages summary.
+    printf("Access stages duration (us), %u accesses\n", completed_count);
+    printf("%-12s %10s %10s %10s %10s\n", "stage", "count", "p50", "p99", "max");
+    for (stage = 0; stage < UNA_TRACE_STAGE_LAST; stage++) {
+        UNA_TRACE_get_summary(stage, &summary);
+        _BENCH_print_trace_summary(BENCH_TRACE_STAGE_NAME[stage], &summary);
+    }
+    printf("\nTotal access duration per node (us)\n");
+    printf("%-12s %10s %10s %10s %10s\n", "node", "count", "p50", "p99", "max");
+    for (node_addr = 0; node_addr < UNA_NODE_ADDRESS_LAST; node_addr++) {
+        UNA_TRACE_get_node_summary(node_addr, UNA_TRACE_STAGE_TOTAL, &summary);
+        if (summary.count == 0) {
+            continue;
+        }
+        snprintf(node_name, sizeof(node_name), "0x%02X", node_addr);
+        _BENCH_print_trace_summary(node_name, &summary);
+    }
+    return EXIT_SUCCESS;
+}
+#endif
+
+/*** BENCH functions ***/
+
+/*******************************************************************/
+int main(int argc, char_t* argv[]) {
+    // Local variables.
+    uint32_t error_count = 0;
+    uint32_t codec_idx = 0;
+    BENCH_distribution_t distribution = 0;
+#ifdef UNA_LIB_USE_TRACE
+    // Access stages tracing on the simulated bus.
+    if ((argc > 1) && (strcmp(argv[1], "--trace") == 0)) {
+        return _BENCH_run_trace();
+    }
+#else
+    // No option without tracing.
+    (void) argc;
+    (void) argv;
+#endif
+    // Check current behavior first.
+    for (codec_idx = 0; codec_idx < (sizeof(BENCH_CODEC) / sizeof(BENCH_codec_t)); codec_idx++) {
+        error_count += _BENCH_check_codec(&(BENCH_CODEC[codec_idx]));
+    }
+    printf("Reference check: %s (%u errors)\n\n", ((error_count == 0) ? "PASSED" : "FAILED"), error_count);
+    // Run benchmarks.
+    for (codec_idx = 0; codec_idx < (sizeof(BENCH_CODEC) / sizeof(BENCH_codec_t)); codec_idx++) {
+        for (distribution = 0; distribution < BENCH_DISTRIBUTION_LAST; distribution++) {
+            _BENCH_run_codec(&(BENCH_CODEC[codec_idx]), distribution);
+        }
+    }
+    return ((error_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
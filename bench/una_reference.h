@@ -0,0 +1,123 @@
+/*
+ * una_reference.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_REFERENCE_H__
+#define __UNA_REFERENCE_H__
+
+#include "types.h"
+
+/*** UNA REFERENCE functions ***/
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REFERENCE_convert_seconds(int32_t time_seconds)
+ * \brief Reference encoding with the original UNA_convert_seconds function.
+ *******************************************************************/
+uint32_t UNA_REFERENCE_convert_seconds(int32_t time_seconds);
+
+/*!******************************************************************
+ * \fn int32_t UNA_REFERENCE_get_seconds(uint32_t una_time)
+ * \brief Reference decoding with the original UNA_get_seconds function.
+ *******************************************************************/
+int32_t UNA_REFERENCE_get_seconds(uint32_t una_time);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REFERENCE_convert_year(int32_t year)
+ * \brief Reference encoding with the original UNA_convert_year function.
+ *******************************************************************/
+uint32_t UNA_REFERENCE_convert_year(int32_t year);
+
+/*!******************************************************************
+ * \fn int32_t UNA_REFERENCE_get_year(uint32_t una_year)
+ * \brief Reference decoding with the original UNA_get_year function.
+ *******************************************************************/
+int32_t UNA_REFERENCE_get_year(uint32_t una_year);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REFERENCE_convert_tenth_degrees(int32_t temperature_tenth_degrees)
+ * \brief Reference encoding with the original UNA_convert_tenth_degrees function.
+ *******************************************************************/
+uint32_t UNA_REFERENCE_convert_tenth_degrees(int32_t temperature_tenth_degrees);
+
+/*!******************************************************************
+ * \fn int32_t UNA_REFERENCE_get_tenth_degrees(uint32_t una_temperature)
+ * \brief Reference decoding with the original UNA_get_tenth_degrees function.
+ *******************************************************************/
+int32_t UNA_REFERENCE_get_tenth_degrees(uint32_t una_temperature);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REFERENCE_convert_mv(int32_t voltage_mv)
+ * \brief Reference encoding with the original UNA_convert_mv function.
+ *******************************************************************/
+uint32_t UNA_REFERENCE_convert_mv(int32_t voltage_mv);
+
+/*!******************************************************************
+ * \fn int32_t UNA_REFERENCE_get_mv(uint32_t una_voltage)
+ * \brief Reference decoding with the original UNA_get_mv function.
+ *******************************************************************/
+int32_t UNA_REFERENCE_get_mv(uint32_t una_voltage);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REFERENCE_convert_ua(int32_t current_ua)
+ * \brief Reference encoding with the original UNA_convert_ua function.
+ *******************************************************************/
+uint32_t UNA_REFERENCE_convert_ua(int32_t current_ua);
+
+/*!******************************************************************
+ * \fn int32_t UNA_REFERENCE_get_ua(uint32_t una_current)
+ * \brief Reference decoding with the original UNA_get_ua function.
+ *******************************************************************/
+int32_t UNA_REFERENCE_get_ua(uint32_t una_current);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REFERENCE_convert_mw_mva(int32_t electrical_power_mw_mva)
+ * \brief Reference encoding with the original UNA_convert_mw_mva function.
+ *******************************************************************/
+uint32_t UNA_REFERENCE_convert_mw_mva(int32_t electrical_power_mw_mva);
+
+/*!******************************************************************
+ * \fn int32_t UNA_REFERENCE_get_mw_mva(uint32_t una_electrical_power)
+ * \brief Reference decoding with the original UNA_get_mw_mva function.
+ *******************************************************************/
+int32_t UNA_REFERENCE_get_mw_mva(uint32_t una_electrical_power);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REFERENCE_convert_mwh_mvah(int32_t electrical_energy_mwh_mvah)
+ * \brief Reference encoding with the original UNA_convert_mwh_mvah function.
+ *******************************************************************/
+uint32_t UNA_REFERENCE_convert_mwh_mvah(int32_t electrical_energy_mwh_mvah);
+
+/*!******************************************************************
+ * \fn int32_t UNA_REFERENCE_get_mwh_mvah(uint32_t una_electrical_energy)
+ * \brief Reference decoding with the original UNA_get_mwh_mvah function.
+ *******************************************************************/
+int32_t UNA_REFERENCE_get_mwh_mvah(uint32_t una_electrical_energy);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REFERENCE_convert_power_factor(int32_t power_factor)
+ * \brief Reference encoding with the original UNA_convert_power_factor function.
+ *******************************************************************/
+uint32_t UNA_REFERENCE_convert_power_factor(int32_t power_factor);
+
+/*!******************************************************************
+ * \fn int32_t UNA_REFERENCE_get_power_factor(uint32_t una_power_factor)
+ * \brief Reference decoding with the original UNA_get_power_factor function.
+ *******************************************************************/
+int32_t UNA_REFERENCE_get_power_factor(uint32_t una_power_factor);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REFERENCE_convert_dbm(int32_t rf_power_dbm)
+ * \brief Reference encoding with the original UNA_convert_dbm function.
+ *******************************************************************/
+uint32_t UNA_REFERENCE_convert_dbm(int32_t rf_power_dbm);
+
+/*!******************************************************************
+ * \fn int32_t UNA_REFERENCE_get_dbm(uint32_t una_rf_power)
+ * \brief Reference decoding with the original UNA_get_dbm function.
+ *******************************************************************/
+int32_t UNA_REFERENCE_get_dbm(uint32_t una_rf_power);
+
+#endif /* __UNA_REFERENCE_H__ */
@@ -42,6 +42,26 @@
 #define UNA_NODE_ADDRESS_RANGE_RRM          8
 #define UNA_NODE_ADDRESS_RANGE_R4S8CR       15
 
+#define UNA_FLOATING_UNIT_NUMBER_MAX        4
+
+#define UNA_FLOATING_UNIT_LOG2_CEIL(divisor) \
+    (((divisor) <= 1) ? 0 : (32 - __builtin_clz((uint32_t) ((divisor) - 1))))
+
+#define UNA_FLOATING_UNIT_RECIPROCAL(divisor) \
+    { ((((uint64_t) 0b1) << (32 + UNA_FLOATING_UNIT_LOG2_CEIL(divisor))) + (divisor) - 1) / (divisor), (32 + UNA_FLOATING_UNIT_LOG2_CEIL(divisor)) }
+
+#define UNA_FLOATING_UNIT(value_size_bits, unit_size_bits, sign_size_bits, ratio_1, ratio_2, ratio_3) { \
+    (value_size_bits), (unit_size_bits), (sign_size_bits), ((0b1 << (unit_size_bits)) - 1), \
+    { (0b1UL << (value_size_bits)), (0b1UL << (value_size_bits)) * (ratio_1), (0b1UL << (value_size_bits)) * (ratio_1) * (ratio_2) }, \
+    { 1, (ratio_1), (ratio_1) * (ratio_2), (ratio_1) * (ratio_2) * (ratio_3) }, \
+    { \
+        UNA_FLOATING_UNIT_RECIPROCAL(1), \
+        UNA_FLOATING_UNIT_RECIPROCAL(ratio_1), \
+        UNA_FLOATING_UNIT_RECIPROCAL((ratio_1) * (ratio_2)), \
+        UNA_FLOATING_UNIT_RECIPROCAL((ratio_1) * (ratio_2) * (ratio_3)) \
+    } \
+}
+
 /*** UNA structures ***/
 
 /*!******************************************************************
@@ -209,8 +229,64 @@ typedef uint32_t (*UNA_convert_physical_data_t)(int32_t physical_data);
  *******************************************************************/
 typedef int32_t (*UNA_get_physical_data_t)(uint32_t una_representation);
 
+/*!******************************************************************
+ * \fn UNA_get_physical_data_batch_t
+ * \brief Function to convert an array of UNA representations to the corresponding physical data.
+ *******************************************************************/
+typedef void (*UNA_get_physical_data_batch_t)(const uint32_t* una_representation, int32_t* physical_data, uint32_t size);
+
+/*!******************************************************************
+ * \fn UNA_read_register_t
+ * \brief Function to read a node register, the access succeeded if all the status flags are cleared.
+ *******************************************************************/
+typedef void (*UNA_read_register_t)(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status);
+
+/*!******************************************************************
+ * \fn UNA_write_register_t
+ * \brief Function to write a node register, the access succeeded if all the status flags are cleared.
+ *******************************************************************/
+typedef void (*UNA_write_register_t)(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status);
+
+/*!******************************************************************
+ * \struct UNA_reciprocal_t
+ * \brief Fixed-point reciprocal of a unit ratio.
+ *******************************************************************/
+typedef struct {
+    uint64_t multiplier;
+    uint8_t shift;
+} UNA_reciprocal_t;
+
+/*!******************************************************************
+ * \struct UNA_floating_unit_t
+ * \brief Descriptor of a floating unit representation: value field, unit field, optional sign bit and units ratios.
+ *******************************************************************/
+typedef struct {
+    uint8_t value_size_bits;
+    uint8_t unit_size_bits;
+    uint8_t sign_size_bits;
+    uint8_t last_unit;
+    uint32_t threshold[UNA_FLOATING_UNIT_NUMBER_MAX - 1];
+    int32_t unit_multiplier[UNA_FLOATING_UNIT_NUMBER_MAX];
+    UNA_reciprocal_t reciprocal[UNA_FLOATING_UNIT_NUMBER_MAX];
+} UNA_floating_unit_t;
+
+/*!******************************************************************
+ * \struct UNA_transport_t
+ * \brief Bus transport interface.
+ *******************************************************************/
+typedef struct {
+    UNA_read_register_t read_register;
+    UNA_write_register_t write_register;
+} UNA_transport_t;
+
 /*** UNA global variables ***/
 
+extern const UNA_floating_unit_t UNA_FLOATING_UNIT_TIME;
+extern const UNA_floating_unit_t UNA_FLOATING_UNIT_VOLTAGE;
+extern const UNA_floating_unit_t UNA_FLOATING_UNIT_CURRENT;
+extern const UNA_floating_unit_t UNA_FLOATING_UNIT_ELECTRICAL_POWER;
+extern const UNA_floating_unit_t UNA_FLOATING_UNIT_ELECTRICAL_ENERGY;
+
 #ifdef UNA_LIB_USE_BOARD_NAME
 extern const char_t* const UNA_BOARD_NAME[UNA_BOARD_ID_LAST];
 #endif
@@ -226,6 +302,68 @@ extern const char_t* const UNA_BOARD_NAME[UNA_BOARD_ID_LAST];
  *******************************************************************/
 void UNA_reset_node_list(UNA_node_list_t* node_list);
 
+/*!******************************************************************
+ * \fn UNA_board_id_t UNA_get_board_id(UNA_node_address_t node_addr, uint8_t* node_index)
+ * \brief Get the board of a node address in constant time.
+ * \param[in]   node_addr: Node address.
+ * \param[out]  node_index: Optional pointer to the index of the node in the board address range.
+ * \retval      Board identifier, UNA_BOARD_ID_ERROR if the address is not assigned to any board.
+ *******************************************************************/
+UNA_board_id_t UNA_get_board_id(UNA_node_address_t node_addr, uint8_t* node_index);
+
+#ifdef UNA_LIB_USE_BOARD_NAME
+/*!******************************************************************
+ * \fn UNA_board_id_t UNA_get_board_id_from_name(const char_t* board_name)
+ * \brief Get a board identifier from its name with a perfect hash lookup.
+ * \param[in]   board_name: Null terminated board name, as given in the UNA_BOARD_NAME list.
+ * \param[out]  none
+ * \retval      Board identifier, UNA_BOARD_ID_ERROR if the name is unknown.
+ *******************************************************************/
+UNA_board_id_t UNA_get_board_id_from_name(const char_t* board_name);
+#endif
+
+/*!******************************************************************
+ * \fn uint32_t UNA_convert_floating_unit(const UNA_floating_unit_t* floating_unit, int32_t physical_data)
+ * \brief Convert a physical data to a floating unit UNA representation. The sign is dropped if the descriptor has no sign bit.
+ * \param[in]   floating_unit: Representation descriptor, defined with the UNA_FLOATING_UNIT macro.
+ * \param[in]   physical_data: Value to convert, in the smallest unit.
+ * \param[out]  none
+ * \retval      UNA representation.
+ *******************************************************************/
+uint32_t UNA_convert_floating_unit(const UNA_floating_unit_t* floating_unit, int32_t physical_data);
+
+/*!******************************************************************
+ * \fn void UNA_convert_floating_unit_batch(const UNA_floating_unit_t* floating_unit, const int32_t* physical_data, uint32_t* una_representation, uint32_t size)
+ * \brief Convert an array of physical data to a floating unit UNA representation.
+ * \param[in]   floating_unit: Representation descriptor, defined with the UNA_FLOATING_UNIT macro.
+ * \param[in]   physical_data: Values to convert, in the smallest unit.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  una_representation: UNA representations.
+ * \retval      none
+ *******************************************************************/
+void UNA_convert_floating_unit_batch(const UNA_floating_unit_t* floating_unit, const int32_t* physical_data, uint32_t* una_representation, uint32_t size);
+
+/*!******************************************************************
+ * \fn int32_t UNA_get_floating_unit(const UNA_floating_unit_t* floating_unit, uint32_t una_representation)
+ * \brief Convert a floating unit UNA representation to physical data.
+ * \param[in]   floating_unit: Representation descriptor, defined with the UNA_FLOATING_UNIT macro.
+ * \param[in]   una_representation: UNA representation to convert.
+ * \param[out]  none
+ * \retval      Converted value in the smallest unit.
+ *******************************************************************/
+int32_t UNA_get_floating_unit(const UNA_floating_unit_t* floating_unit, uint32_t una_representation);
+
+/*!******************************************************************
+ * \fn void UNA_get_floating_unit_batch(const UNA_floating_unit_t* floating_unit, const uint32_t* una_representation, int32_t* physical_data, uint32_t size)
+ * \brief Convert an array of floating unit UNA representations to physical data.
+ * \param[in]   floating_unit: Representation descriptor, defined with the UNA_FLOATING_UNIT macro.
+ * \param[in]   una_representation: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  physical_data: Converted values in the smallest unit.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_floating_unit_batch(const UNA_floating_unit_t* floating_unit, const uint32_t* una_representation, int32_t* physical_data, uint32_t size);
+
 /*!******************************************************************
  * \fn uint32_t UNA_convert_seconds(int32_t time_seconds)
  * \brief Convert a time to UNA representation.
@@ -235,6 +373,16 @@ void UNA_reset_node_list(UNA_node_list_t* node_list);
  *******************************************************************/
 uint32_t UNA_convert_seconds(int32_t time_seconds);
 
+/*!******************************************************************
+ * \fn void UNA_convert_seconds_batch(const int32_t* time_seconds, uint32_t* una_time, uint32_t size)
+ * \brief Convert an array of time values to UNA representation.
+ * \param[in]   time_seconds: Values to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  una_time: UNA representations.
+ * \retval      none
+ *******************************************************************/
+void UNA_convert_seconds_batch(const int32_t* time_seconds, uint32_t* una_time, uint32_t size);
+
 /*!******************************************************************
  * \fn int32_t UNA_get_seconds(uint32_t una_time)
  * \brief Convert a UNA representation to time.
@@ -244,6 +392,16 @@ uint32_t UNA_convert_seconds(int32_t time_seconds);
  *******************************************************************/
 int32_t UNA_get_seconds(uint32_t una_time);
 
+/*!******************************************************************
+ * \fn void UNA_get_seconds_batch(const uint32_t* una_time, int32_t* time_seconds, uint32_t size)
+ * \brief Convert an array of UNA representations to time.
+ * \param[in]   una_time: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  time_seconds: Converted time values in seconds.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_seconds_batch(const uint32_t* una_time, int32_t* time_seconds, uint32_t size);
+
 /*!******************************************************************
  * \fn uint32_t UNA_convert_year(int32_t year)
  * \brief Convert a year to UNA representation.
@@ -262,6 +420,16 @@ uint32_t UNA_convert_year(int32_t year);
  *******************************************************************/
 int32_t UNA_get_year(uint32_t una_year);
 
+/*!******************************************************************
+ * \fn void UNA_get_year_batch(const uint32_t* una_year, int32_t* year, uint32_t size)
+ * \brief Convert an array of UNA representations to year.
+ * \param[in]   una_year: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  year: Converted year values.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_year_batch(const uint32_t* una_year, int32_t* year, uint32_t size);
+
 /*!******************************************************************
  * \fn uint32_t UNA_convert_degrees(int32_t temperature_tenth_degrees)
  * \brief Convert a temperature to UNA representation.
@@ -280,6 +448,16 @@ uint32_t UNA_convert_tenth_degrees(int32_t temperature_tenth_degrees);
  *******************************************************************/
 int32_t UNA_get_tenth_degrees(uint32_t una_temperature);
 
+/*!******************************************************************
+ * \fn void UNA_get_tenth_degrees_batch(const uint32_t* una_temperature, int32_t* temperature_tenth_degrees, uint32_t size)
+ * \brief Convert an array of UNA representations to temperature.
+ * \param[in]   una_temperature: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  temperature_tenth_degrees: Converted temperature values in 1/10 Celsius degrees.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_tenth_degrees_batch(const uint32_t* una_temperature, int32_t* temperature_tenth_degrees, uint32_t size);
+
 /*!******************************************************************
  * \fn uint32_t UNA_convert_mv(int32_t voltage_mv)
  * \brief Convert a voltage to UNA representation.
@@ -289,6 +467,16 @@ int32_t UNA_get_tenth_degrees(uint32_t una_temperature);
  *******************************************************************/
 uint32_t UNA_convert_mv(int32_t voltage_mv);
 
+/*!******************************************************************
+ * \fn void UNA_convert_mv_batch(const int32_t* voltage_mv, uint32_t* una_voltage, uint32_t size)
+ * \brief Convert an array of voltage values to UNA representation.
+ * \param[in]   voltage_mv: Values to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  una_voltage: UNA representations.
+ * \retval      none
+ *******************************************************************/
+void UNA_convert_mv_batch(const int32_t* voltage_mv, uint32_t* una_voltage, uint32_t size);
+
 /*!******************************************************************
  * \fn int32_t UNA_get_mv(uint32_t una_voltage)
  * \brief Convert a UNA representation to voltage.
@@ -298,6 +486,16 @@ uint32_t UNA_convert_mv(int32_t voltage_mv);
  *******************************************************************/
 int32_t UNA_get_mv(uint32_t una_voltage);
 
+/*!******************************************************************
+ * \fn void UNA_get_mv_batch(const uint32_t* una_voltage, int32_t* voltage_mv, uint32_t size)
+ * \brief Convert an array of UNA representations to voltage.
+ * \param[in]   una_voltage: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  voltage_mv: Converted voltage values in mV.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_mv_batch(const uint32_t* una_voltage, int32_t* voltage_mv, uint32_t size);
+
 /*!******************************************************************
  * \fn uint32_t UNA_convert_ua(int32_t current_ua)
  * \brief Convert a current to UNA representation.
@@ -307,6 +505,16 @@ int32_t UNA_get_mv(uint32_t una_voltage);
  *******************************************************************/
 uint32_t UNA_convert_ua(int32_t current_ua);
 
+/*!******************************************************************
+ * \fn void UNA_convert_ua_batch(const int32_t* current_ua, uint32_t* una_current, uint32_t size)
+ * \brief Convert an array of current values to UNA representation.
+ * \param[in]   current_ua: Values to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  una_current: UNA representations.
+ * \retval      none
+ *******************************************************************/
+void UNA_convert_ua_batch(const int32_t* current_ua, uint32_t* una_current, uint32_t size);
+
 /*!******************************************************************
  * \fn int32_t UNA_get_ua(uint32_t una_current)
  * \brief Convert a UNA representation to current.
@@ -316,6 +524,16 @@ uint32_t UNA_convert_ua(int32_t current_ua);
  *******************************************************************/
 int32_t UNA_get_ua(uint32_t una_current);
 
+/*!******************************************************************
+ * \fn void UNA_get_ua_batch(const uint32_t* una_current, int32_t* current_ua, uint32_t size)
+ * \brief Convert an array of UNA representations to current.
+ * \param[in]   una_current: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  current_ua: Converted current values in uA.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_ua_batch(const uint32_t* una_current, int32_t* current_ua, uint32_t size);
+
 /*!******************************************************************
  * \fn uint32_t UNA_convert_mw_mva(int32_t electrical_power_mw_mva)
  * \brief Convert an electrical power to UNA representation.
@@ -325,6 +543,16 @@ int32_t UNA_get_ua(uint32_t una_current);
  *******************************************************************/
 uint32_t UNA_convert_mw_mva(int32_t electrical_power_mw_mva);
 
+/*!******************************************************************
+ * \fn void UNA_convert_mw_mva_batch(const int32_t* electrical_power_mw_mva, uint32_t* una_electrical_power, uint32_t size)
+ * \brief Convert an array of electrical power values to UNA representation.
+ * \param[in]   electrical_power_mw_mva: Values to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  una_electrical_power: UNA representations.
+ * \retval      none
+ *******************************************************************/
+void UNA_convert_mw_mva_batch(const int32_t* electrical_power_mw_mva, uint32_t* una_electrical_power, uint32_t size);
+
 /*!******************************************************************
  * \fn int32_t UNA_get_mw_mva(uint32_t una_electrical_power)
  * \brief Convert a UNA representation to electrical power.
@@ -334,6 +562,16 @@ uint32_t UNA_convert_mw_mva(int32_t electrical_power_mw_mva);
  *******************************************************************/
 int32_t UNA_get_mw_mva(uint32_t una_electrical_power);
 
+/*!******************************************************************
+ * \fn void UNA_get_mw_mva_batch(const uint32_t* una_electrical_power, int32_t* electrical_power_mw_mva, uint32_t size)
+ * \brief Convert an array of UNA representations to electrical power.
+ * \param[in]   una_electrical_power: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  electrical_power_mw_mva: Converted electrical power values in mW or mVA.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_mw_mva_batch(const uint32_t* una_electrical_power, int32_t* electrical_power_mw_mva, uint32_t size);
+
 /*!******************************************************************
  * \fn uint32_t UNA_convert_mwh_mvah(int32_t electrical_energy_mwh_mvah)
  * \brief Convert an electrical energy to UNA representation.
@@ -343,6 +581,16 @@ int32_t UNA_get_mw_mva(uint32_t una_electrical_power);
  *******************************************************************/
 uint32_t UNA_convert_mwh_mvah(int32_t electrical_energy_mwh_mvah);
 
+/*!******************************************************************
+ * \fn void UNA_convert_mwh_mvah_batch(const int32_t* electrical_energy_mwh_mvah, uint32_t* una_electrical_energy, uint32_t size)
+ * \brief Convert an array of electrical energy values to UNA representation.
+ * \param[in]   electrical_energy_mwh_mvah: Values to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  una_electrical_energy: UNA representations.
+ * \retval      none
+ *******************************************************************/
+void UNA_convert_mwh_mvah_batch(const int32_t* electrical_energy_mwh_mvah, uint32_t* una_electrical_energy, uint32_t size);
+
 /*!******************************************************************
  * \fn int32_t UNA_get_mwh_mvah(uint32_t una_electrical_energy)
  * \brief Convert a UNA representation to electrical energy.
@@ -352,6 +600,16 @@ uint32_t UNA_convert_mwh_mvah(int32_t electrical_energy_mwh_mvah);
  *******************************************************************/
 int32_t UNA_get_mwh_mvah(uint32_t una_electrical_energy);
 
+/*!******************************************************************
+ * \fn void UNA_get_mwh_mvah_batch(const uint32_t* una_electrical_energy, int32_t* electrical_energy_mwh_mvah, uint32_t size)
+ * \brief Convert an array of UNA representations to electrical energy.
+ * \param[in]   una_electrical_energy: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  electrical_energy_mwh_mvah: Converted electrical energy values in mWh or mVAh.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_mwh_mvah_batch(const uint32_t* una_electrical_energy, int32_t* electrical_energy_mwh_mvah, uint32_t size);
+
 /*!******************************************************************
  * \fn uint32_t UNA_convert_power_factor(int32_t power_factor)
  * \brief Convert an power factor to UNA representation.
@@ -370,6 +628,16 @@ uint32_t UNA_convert_power_factor(int32_t power_factor);
  *******************************************************************/
 int32_t UNA_get_power_factor(uint32_t una_power_factor);
 
+/*!******************************************************************
+ * \fn void UNA_get_power_factor_batch(const uint32_t* una_power_factor, int32_t* power_factor, uint32_t size)
+ * \brief Convert an array of UNA representations to power factor.
+ * \param[in]   una_power_factor: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  power_factor: Converted power factor values.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_power_factor_batch(const uint32_t* una_power_factor, int32_t* power_factor, uint32_t size);
+
 /*!******************************************************************
  * \fn uint32_t UNA_convert_dbm(int32_t rf_power_dbm)
  * \brief Convert an RF power to UNA representation.
@@ -388,6 +656,134 @@ uint32_t UNA_convert_dbm(int32_t rf_power_dbm);
  *******************************************************************/
 int32_t UNA_get_dbm(uint32_t una_rf_power);
 
+/*!******************************************************************
+ * \fn void UNA_get_dbm_batch(const uint32_t* una_rf_power, int32_t* rf_power_dbm, uint32_t size)
+ * \brief Convert an array of UNA representations to RF power.
+ * \param[in]   una_rf_power: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  rf_power_dbm: Converted RF power values in dBm.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_dbm_batch(const uint32_t* una_rf_power, int32_t* rf_power_dbm, uint32_t size);
+
+#ifdef UNA_LIB_USE_FLOAT
+/*!******************************************************************
+ * \fn float64_t UNA_get_v(uint32_t una_voltage)
+ * \brief Convert UNA representation to voltage in V.
+ * \param[in]   una_voltage: UNA voltage representation to convert.
+ * \param[out]  none
+ * \retval      Voltage in V.
+ *******************************************************************/
+float64_t UNA_get_v(uint32_t una_voltage);
+
+/*!******************************************************************
+ * \fn void UNA_get_v_batch(const uint32_t* una_voltage, float64_t* voltage_v, uint32_t size)
+ * \brief Convert an array of UNA representations to voltage in V.
+ * \param[in]   una_voltage: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  voltage_v: Converted voltage values in V.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_v_batch(const uint32_t* una_voltage, float64_t* voltage_v, uint32_t size);
+
+/*!******************************************************************
+ * \fn void UNA_get_v_batch_float32(const uint32_t* una_voltage, float32_t* voltage_v, uint32_t size)
+ * \brief Convert an array of UNA representations to voltage in V.
+ * \param[in]   una_voltage: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  voltage_v: Converted voltage values in V.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_v_batch_float32(const uint32_t* una_voltage, float32_t* voltage_v, uint32_t size);
+
+/*!******************************************************************
+ * \fn float64_t UNA_get_a(uint32_t una_current)
+ * \brief Convert UNA representation to current in A.
+ * \param[in]   una_current: UNA current representation to convert.
+ * \param[out]  none
+ * \retval      Current in A.
+ *******************************************************************/
+float64_t UNA_get_a(uint32_t una_current);
+
+/*!******************************************************************
+ * \fn void UNA_get_a_batch(const uint32_t* una_current, float64_t* current_a, uint32_t size)
+ * \brief Convert an array of UNA representations to current in A.
+ * \param[in]   una_current: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  current_a: Converted current values in A.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_a_batch(const uint32_t* una_current, float64_t* current_a, uint32_t size);
+
+/*!******************************************************************
+ * \fn void UNA_get_a_batch_float32(const uint32_t* una_current, float32_t* current_a, uint32_t size)
+ * \brief Convert an array of UNA representations to current in A.
+ * \param[in]   una_current: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  current_a: Converted current values in A.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_a_batch_float32(const uint32_t* una_current, float32_t* current_a, uint32_t size);
+
+/*!******************************************************************
+ * \fn float64_t UNA_get_w_va(uint32_t una_electrical_power)
+ * \brief Convert UNA representation to electrical power in W or VA.
+ * \param[in]   una_electrical_power: UNA electrical power representation to convert.
+ * \param[out]  none
+ * \retval      Electrical power in W or VA.
+ *******************************************************************/
+float64_t UNA_get_w_va(uint32_t una_electrical_power);
+
+/*!******************************************************************
+ * \fn void UNA_get_w_va_batch(const uint32_t* una_electrical_power, float64_t* electrical_power_w_va, uint32_t size)
+ * \brief Convert an array of UNA representations to electrical power in W or VA.
+ * \param[in]   una_electrical_power: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  electrical_power_w_va: Converted electrical power values in W or VA.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_w_va_batch(const uint32_t* una_electrical_power, float64_t* electrical_power_w_va, uint32_t size);
+
+/*!******************************************************************
+ * \fn void UNA_get_w_va_batch_float32(const uint32_t* una_electrical_power, float32_t* electrical_power_w_va, uint32_t size)
+ * \brief Convert an array of UNA representations to electrical power in W or VA.
+ * \param[in]   una_electrical_power: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  electrical_power_w_va: Converted electrical power values in W or VA.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_w_va_batch_float32(const uint32_t* una_electrical_power, float32_t* electrical_power_w_va, uint32_t size);
+
+/*!******************************************************************
+ * \fn float64_t UNA_get_wh_vah(uint32_t una_electrical_energy)
+ * \brief Convert UNA representation to electrical energy in Wh or VAh.
+ * \param[in]   una_electrical_energy: UNA electrical energy representation to convert.
+ * \param[out]  none
+ * \retval      Electrical energy in Wh or VAh.
+ *******************************************************************/
+float64_t UNA_get_wh_vah(uint32_t una_electrical_energy);
+
+/*!******************************************************************
+ * \fn void UNA_get_wh_vah_batch(const uint32_t* una_electrical_energy, float64_t* electrical_energy_wh_vah, uint32_t size)
+ * \brief Convert an array of UNA representations to electrical energy in Wh or VAh.
+ * \param[in]   una_electrical_energy: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  electrical_energy_wh_vah: Converted electrical energy values in Wh or VAh.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_wh_vah_batch(const uint32_t* una_electrical_energy, float64_t* electrical_energy_wh_vah, uint32_t size);
+
+/*!******************************************************************
+ * \fn void UNA_get_wh_vah_batch_float32(const uint32_t* una_electrical_energy, float32_t* electrical_energy_wh_vah, uint32_t size)
+ * \brief Convert an array of UNA representations to electrical energy in Wh or VAh.
+ * \param[in]   una_electrical_energy: UNA representations to convert.
+ * \param[in]   size: Number of elements to convert.
+ * \param[out]  electrical_energy_wh_vah: Converted electrical energy values in Wh or VAh.
+ * \retval      none
+ *******************************************************************/
+void UNA_get_wh_vah_batch_float32(const uint32_t* una_electrical_energy, float32_t* electrical_energy_wh_vah, uint32_t size);
+#endif
+
 #endif /* UNA_LIB_DISABLE */
 
 #endif /* __UNA_H__ */
@@ -0,0 +1,132 @@
+/*
+ * una_aggregate.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_AGGREGATE_H__
+#define __UNA_AGGREGATE_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA AGGREGATE structures ***/
+
+/*!******************************************************************
+ * \enum UNA_AGGREGATE_status_t
+ * \brief UNA rolling aggregates error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_AGGREGATE_SUCCESS = 0,
+    UNA_AGGREGATE_ERROR_NULL_PARAMETER,
+    UNA_AGGREGATE_ERROR_SIZE,
+    UNA_AGGREGATE_ERROR_EMPTY,
+    // Last base value.
+    UNA_AGGREGATE_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_AGGREGATE_status_t;
+
+/*!******************************************************************
+ * \struct UNA_aggregate_deque_t
+ * \brief Monotonic deque of samples indexes in the window ring buffer.
+ *******************************************************************/
+typedef struct {
+    uint32_t* index_table;
+    uint16_t head;
+    uint16_t count;
+} UNA_aggregate_deque_t;
+
+/*!******************************************************************
+ * \struct UNA_aggregate_t
+ * \brief Rolling aggregates of a channel over a window of samples.
+ *******************************************************************/
+typedef struct {
+    UNA_get_physical_data_t get;
+    int32_t* sample_table;
+    uint16_t window_size;
+    uint16_t sample_index;
+    uint16_t sample_count;
+    int64_t sum;
+    uint32_t last_una_representation;
+    int32_t last_physical_data;
+    UNA_aggregate_deque_t min_deque;
+    UNA_aggregate_deque_t max_deque;
+} UNA_aggregate_t;
+
+/*!******************************************************************
+ * \struct UNA_aggregate_result_t
+ * \brief Rolling aggregates of the current window.
+ *******************************************************************/
+typedef struct {
+    int32_t min;
+    int32_t max;
+    int32_t mean;
+    int32_t last;
+    uint16_t count;
+} UNA_aggregate_result_t;
+
+/*** UNA AGGREGATE functions ***/
+
+/*!******************************************************************
+ * \fn UNA_AGGREGATE_status_t UNA_AGGREGATE_init(UNA_aggregate_t* aggregate, UNA_get_physical_data_t get, int32_t* sample_table, uint32_t* min_deque_table, uint32_t* max_deque_table, uint16_t window_size)
+ * \brief Init the rolling aggregates of a channel.
+ * \param[in]   aggregate: Aggregate to initialize.
+ * \param[in]   get: Decoding function of the channel representation.
+ * \param[in]   sample_table: Window ring buffer, allocated by the caller with window_size elements.
+ * \param[in]   min_deque_table: Minimum deque storage, allocated by the caller with window_size elements.
+ * \param[in]   max_deque_table: Maximum deque storage, allocated by the caller with window_size elements.
+ * \param[in]   window_size: Number of samples of the window.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_AGGREGATE_status_t UNA_AGGREGATE_init(UNA_aggregate_t* aggregate, UNA_get_physical_data_t get, int32_t* sample_table, uint32_t* min_deque_table, uint32_t* max_deque_table, uint16_t window_size);
+
+/*!******************************************************************
+ * \fn void UNA_AGGREGATE_reset(UNA_aggregate_t* aggregate)
+ * \brief Remove all samples of the window.
+ * \param[in]   aggregate: Aggregate to reset.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_AGGREGATE_reset(UNA_aggregate_t* aggregate);
+
+/*!******************************************************************
+ * \fn void UNA_AGGREGATE_update(UNA_aggregate_t* aggregate, uint32_t una_representation)
+ * \brief Add a raw sample to the window in constant time. The oldest sample is evicted once the window is full.
+ * \param[in]   aggregate: Aggregate to update.
+ * \param[in]   una_representation: Raw UNA representation of the sample.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_AGGREGATE_update(UNA_aggregate_t* aggregate, uint32_t una_representation);
+
+/*!******************************************************************
+ * \fn void UNA_AGGREGATE_update_batch(UNA_aggregate_t* aggregate_table, const uint32_t* una_representation, uint32_t size)
+ * \brief Add one raw sample to each channel of a poll cycle.
+ * \param[in]   aggregate_table: Aggregates of the channels.
+ * \param[in]   una_representation: Raw UNA representations, indexed like the channels.
+ * \param[in]   size: Number of channels.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_AGGREGATE_update_batch(UNA_aggregate_t* aggregate_table, const uint32_t* una_representation, uint32_t size);
+
+/*!******************************************************************
+ * \fn UNA_AGGREGATE_status_t UNA_AGGREGATE_get(UNA_aggregate_t* aggregate, UNA_aggregate_result_t* result)
+ * \brief Read the aggregates of the current window in constant time.
+ * \param[in]   aggregate: Aggregate to read.
+ * \param[out]  result: Pointer to the aggregates.
+ * \retval      Function execution status, UNA_AGGREGATE_ERROR_EMPTY if the window has no sample.
+ *******************************************************************/
+UNA_AGGREGATE_status_t UNA_AGGREGATE_get(UNA_aggregate_t* aggregate, UNA_aggregate_result_t* result);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_AGGREGATE_H__ */
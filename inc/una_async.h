@@ -0,0 +1,189 @@
+/*
+ * una_async.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_ASYNC_H__
+#define __UNA_ASYNC_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA ASYNC macros ***/
+
+#define UNA_ASYNC_INDEX_NONE    0xFF
+
+/*** UNA ASYNC structures ***/
+
+/*!******************************************************************
+ * \enum UNA_ASYNC_status_t
+ * \brief UNA asynchronous access engine error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_ASYNC_SUCCESS = 0,
+    UNA_ASYNC_ERROR_NULL_PARAMETER,
+    UNA_ASYNC_ERROR_SIZE,
+    UNA_ASYNC_ERROR_BUS_INDEX,
+    UNA_ASYNC_ERROR_ACCESS_TYPE,
+    UNA_ASYNC_ERROR_POOL_FULL,
+    // Last base value.
+    UNA_ASYNC_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_ASYNC_status_t;
+
+/*!******************************************************************
+ * \fn UNA_ASYNC_send_cb_t
+ * \brief Start a register access on a bus segment without waiting for the reply.
+ *******************************************************************/
+typedef void (*UNA_ASYNC_send_cb_t)(uint8_t bus_index, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask);
+
+/*!******************************************************************
+ * \fn UNA_ASYNC_poll_cb_t
+ * \brief Check if the reply of the current access of a bus segment has been received.
+ * \brief Returns 0 while the reply is pending, any other value once reg_value and access_status have been written.
+ *******************************************************************/
+typedef uint8_t (*UNA_ASYNC_poll_cb_t)(uint8_t bus_index, uint32_t* reg_value, UNA_access_status_t* access_status);
+
+/*!******************************************************************
+ * \fn UNA_ASYNC_abort_cb_t
+ * \brief Abort the current access of a bus segment after a reply timeout.
+ *******************************************************************/
+typedef void (*UNA_ASYNC_abort_cb_t)(uint8_t bus_index);
+
+/*!******************************************************************
+ * \fn UNA_ASYNC_completion_cb_t
+ * \brief Access completion callback.
+ *******************************************************************/
+typedef void (*UNA_ASYNC_completion_cb_t)(UNA_access_parameters_t* access_params, uint32_t reg_value, UNA_access_status_t access_status, void* context);
+
+/*!******************************************************************
+ * \struct UNA_async_transport_t
+ * \brief Non-blocking bus transport interface.
+ *******************************************************************/
+typedef struct {
+    UNA_ASYNC_send_cb_t send;
+    UNA_ASYNC_poll_cb_t poll;
+    UNA_ASYNC_abort_cb_t abort;
+} UNA_async_transport_t;
+
+/*!******************************************************************
+ * \enum UNA_async_transaction_state_t
+ * \brief Asynchronous transaction states.
+ *******************************************************************/
+typedef enum {
+    UNA_ASYNC_TRANSACTION_STATE_FREE = 0,
+    UNA_ASYNC_TRANSACTION_STATE_QUEUED,
+    UNA_ASYNC_TRANSACTION_STATE_IN_PROGRESS,
+    UNA_ASYNC_TRANSACTION_STATE_LAST
+} UNA_async_transaction_state_t;
+
+/*!******************************************************************
+ * \struct UNA_async_transaction_t
+ * \brief Asynchronous transaction.
+ *******************************************************************/
+typedef struct {
+    UNA_async_transaction_state_t state;
+    uint8_t bus_index;
+    uint8_t next_index;
+    UNA_access_type_t access_type;
+    UNA_access_parameters_t access_params;
+    uint32_t reg_value;
+    uint32_t reg_mask;
+    uint32_t submit_time_ms;
+    uint32_t send_time_ms;
+    UNA_ASYNC_completion_cb_t completion_callback;
+    void* context;
+#ifdef UNA_LIB_USE_TRACE
+    uint32_t trace_submit_timestamp;
+    uint32_t trace_stage_timestamp;
+#endif
+} UNA_async_transaction_t;
+
+/*!******************************************************************
+ * \struct UNA_async_bus_t
+ * \brief Bus segment context.
+ *******************************************************************/
+typedef struct {
+    uint8_t current_index;
+    uint8_t head_index;
+    uint8_t tail_index;
+} UNA_async_bus_t;
+
+/*!******************************************************************
+ * \struct UNA_async_t
+ * \brief Asynchronous access engine.
+ *******************************************************************/
+typedef struct {
+    const UNA_async_transport_t* transport;
+    UNA_async_transaction_t* transaction_table;
+    uint8_t transaction_number;
+    UNA_async_bus_t* bus_table;
+    uint8_t bus_number;
+    uint32_t sequence_timeout_ms;
+    uint8_t pending_count;
+} UNA_async_t;
+
+/*** UNA ASYNC functions ***/
+
+/*!******************************************************************
+ * \fn UNA_ASYNC_status_t UNA_ASYNC_init(UNA_async_t* engine, const UNA_async_transport_t* transport, UNA_async_transaction_t* transaction_table, uint8_t transaction_number, UNA_async_bus_t* bus_table, uint8_t bus_number, uint32_t sequence_timeout_ms)
+ * \brief Init an asynchronous access engine.
+ * \param[in]   engine: Engine to initialize.
+ * \param[in]   transport: Non-blocking transport interface.
+ * \param[in]   transaction_table: Transactions pool, allocated by the caller.
+ * \param[in]   transaction_number: Number of transactions in the pool.
+ * \param[in]   bus_table: Bus segments contexts, allocated by the caller.
+ * \param[in]   bus_number: Number of bus segments.
+ * \param[in]   sequence_timeout_ms: Maximum delay between submission and completion of an access, must not be 0.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_ASYNC_status_t UNA_ASYNC_init(UNA_async_t* engine, const UNA_async_transport_t* transport, UNA_async_transaction_t* transaction_table, uint8_t transaction_number, UNA_async_bus_t* bus_table, uint8_t bus_number, uint32_t sequence_timeout_ms);
+
+/*!******************************************************************
+ * \fn UNA_ASYNC_status_t UNA_ASYNC_submit(UNA_async_t* engine, uint8_t bus_index, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask, UNA_ASYNC_completion_cb_t completion_callback, void* context, uint32_t now_ms)
+ * \brief Queue a register access. This function never blocks.
+ * \param[in]   engine: Engine to use.
+ * \param[in]   bus_index: Bus segment of the node.
+ * \param[in]   access_type: Read or write access.
+ * \param[in]   access_params: Access parameters.
+ * \param[in]   reg_value: Register value to write.
+ * \param[in]   reg_mask: Bits to write.
+ * \param[in]   completion_callback: Function called when the access is completed.
+ * \param[in]   context: Opaque pointer given to the completion callback.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_ASYNC_status_t UNA_ASYNC_submit(UNA_async_t* engine, uint8_t bus_index, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask, UNA_ASYNC_completion_cb_t completion_callback, void* context, uint32_t now_ms);
+
+/*!******************************************************************
+ * \fn UNA_ASYNC_status_t UNA_ASYNC_process(UNA_async_t* engine, uint32_t now_ms)
+ * \brief Poll the bus segments, complete the finished accesses and start the queued ones. This function never blocks.
+ * \param[in]   engine: Engine to process.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_ASYNC_status_t UNA_ASYNC_process(UNA_async_t* engine, uint32_t now_ms);
+
+/*!******************************************************************
+ * \fn uint8_t UNA_ASYNC_get_pending_count(UNA_async_t* engine)
+ * \brief Get the number of queued or in progress accesses.
+ * \param[in]   engine: Engine to read.
+ * \param[out]  none
+ * \retval      Number of pending accesses.
+ *******************************************************************/
+uint8_t UNA_ASYNC_get_pending_count(UNA_async_t* engine);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_ASYNC_H__ */
@@ -0,0 +1,178 @@
+/*
+ * una_cache.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_CACHE_H__
+#define __UNA_CACHE_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA CACHE macros ***/
+
+#define UNA_CACHE_KEY_NONE      0xFFFF
+
+/*** UNA CACHE structures ***/
+
+/*!******************************************************************
+ * \enum UNA_CACHE_status_t
+ * \brief UNA cache error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_CACHE_SUCCESS = 0,
+    UNA_CACHE_ERROR_NULL_PARAMETER,
+    UNA_CACHE_ERROR_SIZE,
+    UNA_CACHE_ERROR_NODE_ADDRESS,
+    UNA_CACHE_ERROR_FULL,
+    UNA_CACHE_ERROR_MISS,
+    UNA_CACHE_ERROR_ACCESS,
+    // Last base value.
+    UNA_CACHE_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_CACHE_status_t;
+
+/*!******************************************************************
+ * \struct UNA_cache_entry_t
+ * \brief Shadow register cache entry.
+ *******************************************************************/
+typedef struct {
+    volatile uint32_t sequence;
+    volatile uint16_t key;
+    volatile uint8_t valid;
+    volatile uint32_t value;
+    volatile uint32_t dirty_mask;
+    volatile uint32_t timestamp_ms;
+} UNA_cache_entry_t;
+
+/*!******************************************************************
+ * \struct UNA_cache_t
+ * \brief Shadow register cache.
+ *******************************************************************/
+typedef struct {
+    UNA_cache_entry_t* entry_table;
+    uint16_t size;
+} UNA_cache_t;
+
+/*** UNA CACHE functions ***/
+
+/*!******************************************************************
+ * \fn UNA_CACHE_status_t UNA_CACHE_init(UNA_cache_t* cache, UNA_cache_entry_t* entry_table, uint16_t size)
+ * \brief Init a register cache.
+ * \param[in]   cache: Cache to initialize.
+ * \param[in]   entry_table: Entries storage, allocated by the caller.
+ * \param[in]   size: Number of entries, must be a power of 2.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_init(UNA_cache_t* cache, UNA_cache_entry_t* entry_table, uint16_t size);
+
+/*!******************************************************************
+ * \fn void UNA_CACHE_reset(UNA_cache_t* cache)
+ * \brief Remove all entries of a register cache. Must not be called while readers are running.
+ * \param[in]   cache: Cache to reset.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_CACHE_reset(UNA_cache_t* cache);
+
+/*!******************************************************************
+ * \fn UNA_CACHE_status_t UNA_CACHE_update(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value, uint32_t timestamp_ms)
+ * \brief Store a register value read on the bus.
+ * \param[in]   cache: Cache to update.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   reg_addr: Register address.
+ * \param[in]   reg_value: Register value.
+ * \param[in]   timestamp_ms: Time of the bus access.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_update(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value, uint32_t timestamp_ms);
+
+/*!******************************************************************
+ * \fn UNA_CACHE_status_t UNA_CACHE_write(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask)
+ * \brief Modify register bits locally and mark them as dirty until they are written on the bus.
+ * \param[in]   cache: Cache to update.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   reg_addr: Register address.
+ * \param[in]   reg_value: Register value.
+ * \param[in]   reg_mask: Bits to modify.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_write(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask);
+
+/*!******************************************************************
+ * \fn UNA_CACHE_status_t UNA_CACHE_clear_dirty(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_mask)
+ * \brief Clear dirty bits once they have been written on the bus.
+ * \param[in]   cache: Cache to update.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   reg_addr: Register address.
+ * \param[in]   reg_mask: Bits to clear.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_clear_dirty(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_mask);
+
+/*!******************************************************************
+ * \fn void UNA_CACHE_invalidate(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr)
+ * \brief Invalidate a cached register.
+ * \param[in]   cache: Cache to update.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   reg_addr: Register address.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_CACHE_invalidate(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr);
+
+/*!******************************************************************
+ * \fn UNA_CACHE_status_t UNA_CACHE_read(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t max_age_ms, uint32_t now_ms, uint32_t* reg_value, uint32_t* dirty_mask)
+ * \brief Read a cached register without lock. Can be called by several threads while another one updates the cache.
+ * \param[in]   cache: Cache to read.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   reg_addr: Register address.
+ * \param[in]   max_age_ms: Maximum age of the cached value.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  reg_value: Pointer to the cached register value.
+ * \param[out]  dirty_mask: Optional pointer to the bits not written on the bus yet.
+ * \retval      Function execution status, UNA_CACHE_ERROR_MISS if the register is absent, invalid or too old.
+ *******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_read(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t max_age_ms, uint32_t now_ms, uint32_t* reg_value, uint32_t* dirty_mask);
+
+/*!******************************************************************
+ * \fn UNA_CACHE_status_t UNA_CACHE_read_dirty(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t* reg_value, uint32_t* dirty_mask)
+ * \brief Read the locally modified bits of a register, even if the rest of the register is unknown.
+ * \param[in]   cache: Cache to read.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   reg_addr: Register address.
+ * \param[out]  reg_value: Pointer to the cached register value.
+ * \param[out]  dirty_mask: Pointer to the bits not written on the bus yet.
+ * \retval      Function execution status, UNA_CACHE_ERROR_MISS if the register is absent.
+ *******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_read_dirty(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t* reg_value, uint32_t* dirty_mask);
+
+/*!******************************************************************
+ * \fn UNA_CACHE_status_t UNA_CACHE_read_register(UNA_cache_t* cache, UNA_access_parameters_t* read_params, uint32_t max_age_ms, uint32_t now_ms, UNA_read_register_t read_register, uint32_t* reg_value, UNA_access_status_t* read_status)
+ * \brief Read a register from the cache, and from the bus on cache miss.
+ * \param[in]   cache: Cache to use.
+ * \param[in]   read_params: Read access parameters.
+ * \param[in]   max_age_ms: Maximum age of the cached value.
+ * \param[in]   now_ms: Current time.
+ * \param[in]   read_register: Bus read function called on cache miss.
+ * \param[out]  reg_value: Pointer to the register value.
+ * \param[out]  read_status: Pointer to the bus access status, cleared on cache hit.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_read_register(UNA_cache_t* cache, UNA_access_parameters_t* read_params, uint32_t max_age_ms, uint32_t now_ms, UNA_read_register_t read_register, uint32_t* reg_value, UNA_access_status_t* read_status);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_CACHE_H__ */
@@ -0,0 +1,144 @@
+/*
+ * una_discovery.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_DISCOVERY_H__
+#define __UNA_DISCOVERY_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+#include "una_async.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA DISCOVERY macros ***/
+
+#define UNA_DISCOVERY_BUS_NUMBER_MAX    8
+#define UNA_DISCOVERY_BUS_INDEX_NONE    0xFF
+
+/*** UNA DISCOVERY structures ***/
+
+/*!******************************************************************
+ * \enum UNA_DISCOVERY_status_t
+ * \brief UNA discovery engine error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_DISCOVERY_SUCCESS = 0,
+    UNA_DISCOVERY_ERROR_NULL_PARAMETER,
+    UNA_DISCOVERY_ERROR_BUS_NUMBER,
+    UNA_DISCOVERY_ERROR_MODE,
+    UNA_DISCOVERY_ERROR_TIMEOUT,
+    UNA_DISCOVERY_ERROR_BUSY,
+    // Last base value.
+    UNA_DISCOVERY_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_DISCOVERY_status_t;
+
+/*!******************************************************************
+ * \enum UNA_discovery_mode_t
+ * \brief Discovery modes.
+ *******************************************************************/
+typedef enum {
+    UNA_DISCOVERY_MODE_SCAN = 0,
+    UNA_DISCOVERY_MODE_VERIFY,
+    UNA_DISCOVERY_MODE_LAST
+} UNA_discovery_mode_t;
+
+/*!******************************************************************
+ * \struct UNA_discovery_configuration_t
+ * \brief Discovery configuration.
+ *******************************************************************/
+typedef struct {
+    uint32_t timeout_min_ms;
+    uint32_t timeout_max_ms;
+    uint32_t budget_ms;
+    uint8_t full_scan;
+} UNA_discovery_configuration_t;
+
+/*!******************************************************************
+ * \struct UNA_discovery_bus_t
+ * \brief Discovery context of a bus segment.
+ *******************************************************************/
+typedef struct {
+    void* discovery;
+    uint8_t bus_index;
+    uint8_t probe_index;
+    uint8_t in_flight;
+    uint32_t send_time_ms;
+    uint8_t found_table[(UNA_NODE_ADDRESS_LAST + 7) / 8];
+} UNA_discovery_bus_t;
+
+/*!******************************************************************
+ * \struct UNA_discovery_t
+ * \brief Discovery engine.
+ *******************************************************************/
+typedef struct {
+    UNA_async_t* engine;
+    uint8_t* node_bus_table;
+    UNA_node_list_t* node_list;
+    UNA_discovery_configuration_t configuration;
+    uint8_t running;
+    uint32_t start_time_ms;
+    uint32_t now_ms;
+    uint32_t timeout_ms;
+    uint32_t rtt_max_ms;
+    uint32_t probe_count;
+    uint32_t conflict_count;
+    uint8_t probe_number;
+    uint8_t probe_address_table[UNA_NODE_ADDRESS_LAST];
+    uint8_t probe_board_id_table[UNA_NODE_ADDRESS_LAST];
+    uint8_t probe_bus_index_table[UNA_NODE_ADDRESS_LAST];
+    uint8_t listed_table[(UNA_NODE_ADDRESS_LAST + 7) / 8];
+    UNA_discovery_bus_t bus_table[UNA_DISCOVERY_BUS_NUMBER_MAX];
+} UNA_discovery_t;
+
+/*** UNA DISCOVERY functions ***/
+
+/*!******************************************************************
+ * \fn UNA_DISCOVERY_status_t UNA_DISCOVERY_init(UNA_discovery_t* discovery, UNA_async_t* engine, uint8_t* node_bus_table)
+ * \brief Init a discovery engine. Each bus segment of the asynchronous engine walks the whole probes list with its own found state, one probe in flight per segment.
+ * \brief Node addresses are expected to be unique on the whole network: the node list holds one entry per address, and an address replying on a second segment is only counted in conflict_count.
+ * \param[in]   discovery: Discovery engine to initialize.
+ * \param[in]   engine: Initialized asynchronous access engine.
+ * \param[in]   node_bus_table: Optional table of UNA_NODE_ADDRESS_LAST elements, filled with the bus segment of each discovered node and UNA_DISCOVERY_BUS_INDEX_NONE otherwise.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_DISCOVERY_status_t UNA_DISCOVERY_init(UNA_discovery_t* discovery, UNA_async_t* engine, uint8_t* node_bus_table);
+
+/*!******************************************************************
+ * \fn UNA_DISCOVERY_status_t UNA_DISCOVERY_start(UNA_discovery_t* discovery, UNA_discovery_mode_t mode, UNA_discovery_configuration_t* configuration, UNA_node_list_t* node_list, uint32_t now_ms)
+ * \brief Start a discovery. The scan mode probes the known boards ranges first, lowest index in range first, then the other addresses if full_scan is set.
+ * \brief The verify mode only probes the nodes of the given list and keeps the ones which reply with the same board identifier.
+ * \brief In verify mode, nodes with a known bus segment in the node bus table are only probed on this segment, the other segments do not spend a timeout on them.
+ * \param[in]   discovery: Discovery engine to use.
+ * \param[in]   mode: Discovery mode.
+ * \param[in]   configuration: Probes timeout bounds and time budget of the discovery.
+ * \param[in]   node_list: Node list to fill, which also gives the previous result in verify mode.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_DISCOVERY_status_t UNA_DISCOVERY_start(UNA_discovery_t* discovery, UNA_discovery_mode_t mode, UNA_discovery_configuration_t* configuration, UNA_node_list_t* node_list, uint32_t now_ms);
+
+/*!******************************************************************
+ * \fn UNA_DISCOVERY_status_t UNA_DISCOVERY_process(UNA_discovery_t* discovery, uint32_t now_ms, uint8_t* complete)
+ * \brief Process the asynchronous engine and submit the next probes. This function never blocks.
+ * \brief Nodes are appended to the list as soon as they reply, no probe is submitted once the time budget is elapsed.
+ * \param[in]   discovery: Discovery engine to process.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  complete: Pointer set to 1 when all the probes are completed, 0 otherwise.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_DISCOVERY_status_t UNA_DISCOVERY_process(UNA_discovery_t* discovery, uint32_t now_ms, uint8_t* complete);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_DISCOVERY_H__ */
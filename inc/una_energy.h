@@ -0,0 +1,128 @@
+/*
+ * una_energy.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_ENERGY_H__
+#define __UNA_ENERGY_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA ENERGY macros ***/
+
+#define UNA_ENERGY_GROUP_NONE   0xFF
+
+/*** UNA ENERGY structures ***/
+
+/*!******************************************************************
+ * \enum UNA_ENERGY_status_t
+ * \brief UNA energy accumulator error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_ENERGY_SUCCESS = 0,
+    UNA_ENERGY_ERROR_NULL_PARAMETER,
+    UNA_ENERGY_ERROR_SIZE,
+    UNA_ENERGY_ERROR_CHANNEL_INDEX,
+    UNA_ENERGY_ERROR_GROUP_INDEX,
+    // Last base value.
+    UNA_ENERGY_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_ENERGY_status_t;
+
+/*!******************************************************************
+ * \struct UNA_energy_channel_t
+ * \brief Energy meter channel.
+ *******************************************************************/
+typedef struct {
+    int64_t total_mwh_mvah;
+    int32_t last_mwh_mvah;
+    uint32_t reset_count;
+    uint8_t group_index;
+    uint8_t initialized;
+} UNA_energy_channel_t;
+
+/*!******************************************************************
+ * \struct UNA_energy_t
+ * \brief Energy accumulator.
+ *******************************************************************/
+typedef struct {
+    volatile uint32_t generation;
+    UNA_energy_channel_t* channel_table;
+    uint32_t channel_number;
+    int64_t* group_total_table;
+    uint8_t group_number;
+} UNA_energy_t;
+
+/*** UNA ENERGY functions ***/
+
+/*!******************************************************************
+ * \fn UNA_ENERGY_status_t UNA_ENERGY_init(UNA_energy_t* accumulator, UNA_energy_channel_t* channel_table, uint32_t channel_number, int64_t* group_total_table, uint8_t group_number)
+ * \brief Init an energy accumulator. All channels are initially outside of any group.
+ * \param[in]   accumulator: Accumulator to initialize.
+ * \param[in]   channel_table: Channels storage, allocated by the caller.
+ * \param[in]   channel_number: Number of channels.
+ * \param[in]   group_total_table: Groups totals storage, allocated by the caller. Can be NULL if group_number is 0.
+ * \param[in]   group_number: Number of groups.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_init(UNA_energy_t* accumulator, UNA_energy_channel_t* channel_table, uint32_t channel_number, int64_t* group_total_table, uint8_t group_number);
+
+/*!******************************************************************
+ * \fn UNA_ENERGY_status_t UNA_ENERGY_set_group(UNA_energy_t* accumulator, uint32_t channel_index, uint8_t group_index)
+ * \brief Assign a channel to a group.
+ * \param[in]   accumulator: Accumulator to configure.
+ * \param[in]   channel_index: Channel index.
+ * \param[in]   group_index: Group index, or UNA_ENERGY_GROUP_NONE.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_set_group(UNA_energy_t* accumulator, uint32_t channel_index, uint8_t group_index);
+
+/*!******************************************************************
+ * \fn UNA_ENERGY_status_t UNA_ENERGY_ingest_batch(UNA_energy_t* accumulator, uint32_t first_channel_index, const uint32_t* una_electrical_energy, uint32_t size)
+ * \brief Accumulate the meter readings of consecutive channels.
+ * \brief The representation is truncated when the meter switches to a coarser unit, so a magnitude decrease lower than the reading unit step is ignored and the previous reading is kept as reference.
+ * \brief A larger magnitude decrease or a sign change is handled as a counter reset.
+ * \param[in]   accumulator: Accumulator to update.
+ * \param[in]   first_channel_index: Channel of the first reading.
+ * \param[in]   una_electrical_energy: Raw UNA electrical energy representations.
+ * \param[in]   size: Number of readings.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_ingest_batch(UNA_energy_t* accumulator, uint32_t first_channel_index, const uint32_t* una_electrical_energy, uint32_t size);
+
+/*!******************************************************************
+ * \fn UNA_ENERGY_status_t UNA_ENERGY_read_channel(UNA_energy_t* accumulator, uint32_t channel_index, int64_t* total_mwh_mvah, uint32_t* reset_count)
+ * \brief Read the total energy of a channel without blocking the ingest path.
+ * \param[in]   accumulator: Accumulator to read.
+ * \param[in]   channel_index: Channel index.
+ * \param[out]  total_mwh_mvah: Pointer to the total energy in mWh or mVAh.
+ * \param[out]  reset_count: Optional pointer to the number of counter resets detected.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_read_channel(UNA_energy_t* accumulator, uint32_t channel_index, int64_t* total_mwh_mvah, uint32_t* reset_count);
+
+/*!******************************************************************
+ * \fn UNA_ENERGY_status_t UNA_ENERGY_snapshot_groups(UNA_energy_t* accumulator, int64_t* group_total_mwh_mvah, uint8_t group_number)
+ * \brief Copy the consistent totals of all groups without blocking the ingest path. Large batches are ingested by chunks of 32 channels, which can be partially included.
+ * \param[in]   accumulator: Accumulator to read.
+ * \param[in]   group_number: Number of groups to copy.
+ * \param[out]  group_total_mwh_mvah: Groups totals in mWh or mVAh.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_snapshot_groups(UNA_energy_t* accumulator, int64_t* group_total_mwh_mvah, uint8_t group_number);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_ENERGY_H__ */
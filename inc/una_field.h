@@ -0,0 +1,122 @@
+/*
+ * una_field.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_FIELD_H__
+#define __UNA_FIELD_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+#include "una_cache.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA FIELD macros ***/
+
+/*!******************************************************************
+ * \def UNA_FIELD(reg_addr, offset, size_bits, convert, get)
+ * \brief Build a constant field descriptor. Raw fields use NULL codec functions.
+ *******************************************************************/
+#define UNA_FIELD(reg_addr, offset, size_bits, convert, get) \
+    { (reg_addr), (offset), ((uint32_t) ((((uint64_t) 0b1) << (size_bits)) - 1) << (offset)), (convert), (get) }
+
+/*** UNA FIELD structures ***/
+
+/*!******************************************************************
+ * \enum UNA_FIELD_status_t
+ * \brief UNA register fields error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_FIELD_SUCCESS = 0,
+    UNA_FIELD_ERROR_NULL_PARAMETER,
+    UNA_FIELD_ERROR_NODE_ADDRESS,
+    UNA_FIELD_ERROR_SHADOW,
+    UNA_FIELD_ERROR_ACCESS,
+    // Last base value.
+    UNA_FIELD_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_FIELD_status_t;
+
+/*!******************************************************************
+ * \struct UNA_field_t
+ * \brief Register field descriptor.
+ *******************************************************************/
+typedef struct {
+    uint8_t reg_addr;
+    uint8_t offset;
+    uint32_t mask;
+    UNA_convert_physical_data_t convert;
+    UNA_get_physical_data_t get;
+} UNA_field_t;
+
+/*** UNA FIELD functions ***/
+
+/*!******************************************************************
+ * \fn void UNA_FIELD_encode(const UNA_field_t* field, int32_t physical_data, uint32_t* reg_value, uint32_t* reg_mask)
+ * \brief Insert a field in a register value. Several fields of the same register can be accumulated before a single write.
+ * \param[in]   field: Field descriptor.
+ * \param[in]   physical_data: Field value, converted with the field codec if any.
+ * \param[out]  reg_value: Pointer to the register value to update.
+ * \param[out]  reg_mask: Pointer to the register mask to update.
+ * \retval      none
+ *******************************************************************/
+void UNA_FIELD_encode(const UNA_field_t* field, int32_t physical_data, uint32_t* reg_value, uint32_t* reg_mask);
+
+/*!******************************************************************
+ * \fn int32_t UNA_FIELD_decode(const UNA_field_t* field, uint32_t reg_value)
+ * \brief Extract a field from a register value.
+ * \param[in]   field: Field descriptor.
+ * \param[in]   reg_value: Register value.
+ * \param[out]  none
+ * \retval      Field value, converted with the field codec if any.
+ *******************************************************************/
+int32_t UNA_FIELD_decode(const UNA_field_t* field, uint32_t reg_value);
+
+/*!******************************************************************
+ * \fn UNA_FIELD_status_t UNA_FIELD_set(UNA_cache_t* shadow, UNA_node_address_t node_addr, const UNA_field_t* field, int32_t physical_data)
+ * \brief Update a field in the shadow copy of the register. Nothing is marked for writing if the field value is unchanged.
+ * \param[in]   shadow: Cache holding the shadow copy of the registers.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   field: Field descriptor.
+ * \param[in]   physical_data: Field value.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_FIELD_status_t UNA_FIELD_set(UNA_cache_t* shadow, UNA_node_address_t node_addr, const UNA_field_t* field, int32_t physical_data);
+
+/*!******************************************************************
+ * \fn UNA_FIELD_status_t UNA_FIELD_flush(UNA_cache_t* shadow, UNA_access_parameters_t* write_params, UNA_write_register_t write_register, UNA_access_status_t* write_status)
+ * \brief Write all pending fields of a register in a single masked write. The bus is not accessed if no field is pending.
+ * \param[in]   shadow: Cache holding the shadow copy of the registers.
+ * \param[in]   write_params: Write access parameters.
+ * \param[in]   write_register: Bus write function.
+ * \param[out]  write_status: Pointer to the bus access status, cleared when the bus is not accessed.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_FIELD_status_t UNA_FIELD_flush(UNA_cache_t* shadow, UNA_access_parameters_t* write_params, UNA_write_register_t write_register, UNA_access_status_t* write_status);
+
+/*!******************************************************************
+ * \fn UNA_FIELD_status_t UNA_FIELD_read(UNA_cache_t* shadow, UNA_access_parameters_t* read_params, const UNA_field_t* field, uint32_t max_age_ms, uint32_t now_ms, UNA_read_register_t read_register, int32_t* physical_data, UNA_access_status_t* read_status)
+ * \brief Read a field from the shadow copy, and from the bus if the copy is missing or too old.
+ * \param[in]   shadow: Cache holding the shadow copy of the registers.
+ * \param[in]   read_params: Read access parameters, the register address is given by the field descriptor.
+ * \param[in]   field: Field descriptor.
+ * \param[in]   max_age_ms: Maximum age of the shadow copy.
+ * \param[in]   now_ms: Current time.
+ * \param[in]   read_register: Bus read function.
+ * \param[out]  physical_data: Pointer to the field value.
+ * \param[out]  read_status: Pointer to the bus access status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_FIELD_status_t UNA_FIELD_read(UNA_cache_t* shadow, UNA_access_parameters_t* read_params, const UNA_field_t* field, uint32_t max_age_ms, uint32_t now_ms, UNA_read_register_t read_register, int32_t* physical_data, UNA_access_status_t* read_status);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_FIELD_H__ */
@@ -0,0 +1,145 @@
+/*
+ * una_frame.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_FRAME_H__
+#define __UNA_FRAME_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA FRAME macros ***/
+
+#define UNA_FRAME_ADDRESS_MARKER            0x80
+#define UNA_FRAME_END_CHAR                  '\r'
+
+#define UNA_FRAME_HEADER_SIZE_BYTES         2
+#define UNA_FRAME_ACCESS_SIZE_MAX_BYTES     28
+
+/*** UNA FRAME structures ***/
+
+/*!******************************************************************
+ * \enum UNA_FRAME_status_t
+ * \brief UNA frame serializer error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_FRAME_SUCCESS = 0,
+    UNA_FRAME_ERROR_NULL_PARAMETER,
+    UNA_FRAME_ERROR_SIZE,
+    UNA_FRAME_ERROR_MODE,
+    UNA_FRAME_ERROR_NODE_ADDRESS,
+    UNA_FRAME_ERROR_ACCESS_TYPE,
+    UNA_FRAME_ERROR_OVERFLOW,
+    // Last base value.
+    UNA_FRAME_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_FRAME_status_t;
+
+/*!******************************************************************
+ * \enum UNA_frame_buffer_mode_t
+ * \brief Frame buffer modes.
+ *******************************************************************/
+typedef enum {
+    UNA_FRAME_BUFFER_MODE_LINEAR = 0,
+    UNA_FRAME_BUFFER_MODE_RING,
+    UNA_FRAME_BUFFER_MODE_LAST
+} UNA_frame_buffer_mode_t;
+
+/*!******************************************************************
+ * \struct UNA_frame_buffer_t
+ * \brief Frames output buffer, owned by the caller.
+ * \brief Indexes are free running: the serializer only moves the head, the consumer (DMA or UART interrupt) moves the tail of a ring buffer. The tail of a linear buffer does not release any space.
+ *******************************************************************/
+typedef struct {
+    uint8_t* data;
+    uint32_t size;
+    uint32_t index_mask;
+    uint32_t head;
+    volatile uint32_t tail;
+} UNA_frame_buffer_t;
+
+/*** UNA FRAME functions ***/
+
+/*!******************************************************************
+ * \fn UNA_FRAME_status_t UNA_FRAME_init_buffer(UNA_frame_buffer_t* frame_buffer, uint8_t* data, uint32_t size, UNA_frame_buffer_mode_t mode)
+ * \brief Init a frames output buffer. A linear buffer is filled from its start until it is reset, a ring buffer size must be a power of 2.
+ * \param[in]   frame_buffer: Frames buffer to initialize.
+ * \param[in]   data: Buffer memory, allocated by the caller.
+ * \param[in]   size: Buffer size in bytes.
+ * \param[in]   mode: Buffer mode.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_FRAME_status_t UNA_FRAME_init_buffer(UNA_frame_buffer_t* frame_buffer, uint8_t* data, uint32_t size, UNA_frame_buffer_mode_t mode);
+
+/*!******************************************************************
+ * \fn void UNA_FRAME_reset_buffer(UNA_frame_buffer_t* frame_buffer)
+ * \brief Empty a frames buffer, typically once a linear buffer has been sent.
+ * \param[in]   frame_buffer: Frames buffer to reset.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_FRAME_reset_buffer(UNA_frame_buffer_t* frame_buffer);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_FRAME_get_size(UNA_frame_buffer_t* frame_buffer)
+ * \brief Get the number of bytes written and not consumed yet.
+ * \param[in]   frame_buffer: Frames buffer to read.
+ * \param[out]  none
+ * \retval      Number of pending bytes.
+ *******************************************************************/
+uint32_t UNA_FRAME_get_size(UNA_frame_buffer_t* frame_buffer);
+
+/*!******************************************************************
+ * \fn UNA_FRAME_status_t UNA_FRAME_write_access(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask)
+ * \brief Write a register read (AT$R=<reg>) or write (AT$W=<reg>,<value>,<mask>) frame, with hexadecimal fields.
+ * \param[in]   frame_buffer: Frames buffer to fill.
+ * \param[in]   source_addr: Address of the sender.
+ * \param[in]   access_type: Read or write access.
+ * \param[in]   access_params: Access parameters.
+ * \param[in]   reg_value: Register value to write, unused for a read access.
+ * \param[in]   reg_mask: Register bits to write, unused for a read access.
+ * \param[out]  none
+ * \retval      Function execution status, UNA_FRAME_ERROR_OVERFLOW if the frame does not fit (nothing is written).
+ *******************************************************************/
+UNA_FRAME_status_t UNA_FRAME_write_access(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask);
+
+/*!******************************************************************
+ * \fn UNA_FRAME_status_t UNA_FRAME_write_command(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_command_parameters_t* command_params)
+ * \brief Write a raw command frame.
+ * \param[in]   frame_buffer: Frames buffer to fill.
+ * \param[in]   source_addr: Address of the sender.
+ * \param[in]   command_params: Command parameters.
+ * \param[out]  none
+ * \retval      Function execution status, UNA_FRAME_ERROR_OVERFLOW if the frame does not fit (nothing is written).
+ *******************************************************************/
+UNA_FRAME_status_t UNA_FRAME_write_command(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_command_parameters_t* command_params);
+
+/*!******************************************************************
+ * \fn UNA_FRAME_status_t UNA_FRAME_write_access_batch(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_access_type_t access_type, UNA_access_parameters_t* access_params_table, const uint32_t* reg_value_table, const uint32_t* reg_mask_table, uint32_t size, uint32_t* frame_count)
+ * \brief Write access frames back to back, so that they can be sent with a single DMA transfer.
+ * \brief The head is only moved once all frames are written: on error, none of the frames of the batch is committed.
+ * \param[in]   frame_buffer: Frames buffer to fill.
+ * \param[in]   source_addr: Address of the sender.
+ * \param[in]   access_type: Read or write accesses.
+ * \param[in]   access_params_table: Accesses parameters.
+ * \param[in]   reg_value_table: Register values to write, can be NULL for read accesses.
+ * \param[in]   reg_mask_table: Register bits to write, can be NULL for read accesses.
+ * \param[in]   size: Number of accesses.
+ * \param[out]  frame_count: Pointer to the number of committed frames, either size or 0.
+ * \retval      Function execution status, UNA_FRAME_ERROR_OVERFLOW if all frames do not fit.
+ *******************************************************************/
+UNA_FRAME_status_t UNA_FRAME_write_access_batch(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_access_type_t access_type, UNA_access_parameters_t* access_params_table, const uint32_t* reg_value_table, const uint32_t* reg_mask_table, uint32_t size, uint32_t* frame_count);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_FRAME_H__ */
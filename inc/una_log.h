@@ -0,0 +1,180 @@
+/*
+ * una_log.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_LOG_H__
+#define __UNA_LOG_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA LOG macros ***/
+
+#define UNA_LOG_BLOCK_HEADER_SIZE_BYTES     13
+#define UNA_LOG_RECORD_SIZE_MAX_BYTES       12
+#define UNA_LOG_BLOCK_SIZE_MIN_BYTES        (UNA_LOG_BLOCK_HEADER_SIZE_BYTES + UNA_LOG_RECORD_SIZE_MAX_BYTES)
+
+#define UNA_LOG_REGISTER_ADDRESS_ALL        0xFFFF
+
+/*** UNA LOG structures ***/
+
+/*!******************************************************************
+ * \enum UNA_LOG_status_t
+ * \brief UNA telemetry log error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_LOG_SUCCESS = 0,
+    UNA_LOG_ERROR_NULL_PARAMETER,
+    UNA_LOG_ERROR_SIZE,
+    UNA_LOG_ERROR_NODE_ADDRESS,
+    UNA_LOG_ERROR_TIMESTAMP,
+    UNA_LOG_ERROR_CORRUPTED_BLOCK,
+    // Last base value.
+    UNA_LOG_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_LOG_status_t;
+
+/*!******************************************************************
+ * \fn UNA_LOG_write_block_cb_t
+ * \brief Function called to store a complete block.
+ *******************************************************************/
+typedef void (*UNA_LOG_write_block_cb_t)(const uint8_t* block, uint32_t block_size_bytes);
+
+/*!******************************************************************
+ * \struct UNA_log_record_t
+ * \brief Telemetry log record.
+ *******************************************************************/
+typedef struct {
+    UNA_node_address_t node_addr;
+    uint8_t reg_addr;
+    uint32_t timestamp_ms;
+    uint32_t reg_value;
+} UNA_log_record_t;
+
+/*!******************************************************************
+ * \struct UNA_log_writer_t
+ * \brief Telemetry log streaming writer.
+ *******************************************************************/
+typedef struct {
+    uint8_t* block;
+    uint32_t block_size_bytes;
+    uint32_t block_index;
+    uint16_t record_count;
+    uint32_t first_timestamp_ms;
+    uint32_t last_timestamp_ms;
+    uint32_t block_count;
+    UNA_LOG_write_block_cb_t write_block_callback;
+} UNA_log_writer_t;
+
+/*!******************************************************************
+ * \struct UNA_log_reader_t
+ * \brief Telemetry log reader.
+ *******************************************************************/
+typedef struct {
+    const uint8_t* data;
+    uint32_t size_bytes;
+    uint32_t block_offset;
+    uint32_t record_offset;
+    uint32_t payload_end;
+    uint16_t record_index;
+    uint16_t record_count;
+    uint32_t timestamp_ms;
+} UNA_log_reader_t;
+
+/*** UNA LOG functions ***/
+
+/*!******************************************************************
+ * \fn UNA_LOG_status_t UNA_LOG_writer_init(UNA_log_writer_t* writer, uint8_t* block, uint32_t block_size_bytes, UNA_LOG_write_block_cb_t write_block_callback)
+ * \brief Init a telemetry log writer.
+ * \param[in]   writer: Writer to initialize.
+ * \param[in]   block: Block buffer, allocated by the caller.
+ * \param[in]   block_size_bytes: Size of the block buffer, at least UNA_LOG_BLOCK_SIZE_MIN_BYTES.
+ * \param[in]   write_block_callback: Function called to store each complete block.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_LOG_status_t UNA_LOG_writer_init(UNA_log_writer_t* writer, uint8_t* block, uint32_t block_size_bytes, UNA_LOG_write_block_cb_t write_block_callback);
+
+/*!******************************************************************
+ * \fn UNA_LOG_status_t UNA_LOG_write(UNA_log_writer_t* writer, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t timestamp_ms, uint32_t reg_value)
+ * \brief Append a raw register sample to the log. Timestamps must not decrease, including across blocks.
+ * \param[in]   writer: Writer to use.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   reg_addr: Register address.
+ * \param[in]   timestamp_ms: Sample time.
+ * \param[in]   reg_value: Raw register value.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_LOG_status_t UNA_LOG_write(UNA_log_writer_t* writer, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t timestamp_ms, uint32_t reg_value);
+
+/*!******************************************************************
+ * \fn UNA_LOG_status_t UNA_LOG_flush(UNA_log_writer_t* writer)
+ * \brief Store the current block even if it is not full.
+ * \param[in]   writer: Writer to flush.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_LOG_status_t UNA_LOG_flush(UNA_log_writer_t* writer);
+
+/*!******************************************************************
+ * \fn UNA_LOG_status_t UNA_LOG_reader_init(UNA_log_reader_t* reader, const uint8_t* data, uint32_t size_bytes)
+ * \brief Init a telemetry log reader on a memory area, typically a memory-mapped log file.
+ * \param[in]   reader: Reader to initialize.
+ * \param[in]   data: Log content.
+ * \param[in]   size_bytes: Log size.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_LOG_status_t UNA_LOG_reader_init(UNA_log_reader_t* reader, const uint8_t* data, uint32_t size_bytes);
+
+/*!******************************************************************
+ * \fn UNA_LOG_status_t UNA_LOG_seek(UNA_log_reader_t* reader, uint32_t start_timestamp_ms)
+ * \brief Move the reader to the first record at or after the given time, skipping complete blocks with their header.
+ * \param[in]   reader: Reader to use.
+ * \param[in]   start_timestamp_ms: Start of the time range.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_LOG_status_t UNA_LOG_seek(UNA_log_reader_t* reader, uint32_t start_timestamp_ms);
+
+/*!******************************************************************
+ * \fn UNA_LOG_status_t UNA_LOG_read_records(UNA_log_reader_t* reader, uint32_t end_timestamp_ms, UNA_log_record_t* record_table, uint32_t record_number_max, uint32_t* record_number)
+ * \brief Read the next records until the end of the time range or of the output table.
+ * \param[in]   reader: Reader to use.
+ * \param[in]   end_timestamp_ms: End of the time range, included.
+ * \param[in]   record_number_max: Size of the output table.
+ * \param[out]  record_table: Output records.
+ * \param[out]  record_number: Pointer to the number of records read, lower than record_number_max when the range is finished.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_LOG_status_t UNA_LOG_read_records(UNA_log_reader_t* reader, uint32_t end_timestamp_ms, UNA_log_record_t* record_table, uint32_t record_number_max, uint32_t* record_number);
+
+/*!******************************************************************
+ * \fn UNA_LOG_status_t UNA_LOG_read_values(UNA_log_reader_t* reader, uint32_t end_timestamp_ms, UNA_node_address_t node_addr, uint16_t reg_addr, UNA_get_physical_data_batch_t get_batch, uint32_t* timestamp_table, int32_t* physical_data_table, uint32_t value_number_max, uint32_t* value_number)
+ * \brief Read and decode the next samples of a register until the end of the time range or of the output tables.
+ * \param[in]   reader: Reader to use.
+ * \param[in]   end_timestamp_ms: End of the time range, included.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   reg_addr: Register address, or UNA_LOG_REGISTER_ADDRESS_ALL.
+ * \param[in]   get_batch: Batch decoding function of the register representation, raw values are returned if NULL.
+ * \param[in]   value_number_max: Size of the output tables.
+ * \param[out]  timestamp_table: Optional output timestamps.
+ * \param[out]  physical_data_table: Output decoded values.
+ * \param[out]  value_number: Pointer to the number of values read, lower than value_number_max when the range is finished.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_LOG_status_t UNA_LOG_read_values(UNA_log_reader_t* reader, uint32_t end_timestamp_ms, UNA_node_address_t node_addr, uint16_t reg_addr, UNA_get_physical_data_batch_t get_batch, uint32_t* timestamp_table, int32_t* physical_data_table, uint32_t value_number_max, uint32_t* value_number);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_LOG_H__ */
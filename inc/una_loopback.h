@@ -0,0 +1,94 @@
+/*
+ * una_loopback.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_LOOPBACK_H__
+#define __UNA_LOOPBACK_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA LOOPBACK structures ***/
+
+/*!******************************************************************
+ * \enum UNA_LOOPBACK_status_t
+ * \brief UNA loopback transport error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_LOOPBACK_SUCCESS = 0,
+    UNA_LOOPBACK_ERROR_NULL_PARAMETER,
+    UNA_LOOPBACK_ERROR_SIZE,
+    UNA_LOOPBACK_ERROR_NODE_ADDRESS,
+    // Last base value.
+    UNA_LOOPBACK_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_LOOPBACK_status_t;
+
+/*** UNA LOOPBACK global variables ***/
+
+extern const UNA_transport_t UNA_LOOPBACK_TRANSPORT;
+
+/*** UNA LOOPBACK functions ***/
+
+/*!******************************************************************
+ * \fn UNA_LOOPBACK_status_t UNA_LOOPBACK_init(uint32_t* register_file, uint16_t register_number)
+ * \brief Init the in-memory loopback transport. All nodes are absent after initialization.
+ * \param[in]   register_file: Registers storage of all nodes, allocated by the caller with (UNA_NODE_ADDRESS_LAST * register_number) elements.
+ * \param[in]   register_number: Number of registers per node.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_LOOPBACK_status_t UNA_LOOPBACK_init(uint32_t* register_file, uint16_t register_number);
+
+/*!******************************************************************
+ * \fn UNA_LOOPBACK_status_t UNA_LOOPBACK_set_node_presence(UNA_node_address_t node_addr, uint8_t present)
+ * \brief Connect or disconnect a node from the loopback bus.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   present: 0 to disconnect the node, connect it otherwise.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_LOOPBACK_status_t UNA_LOOPBACK_set_node_presence(UNA_node_address_t node_addr, uint8_t present);
+
+/*!******************************************************************
+ * \fn void UNA_LOOPBACK_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status)
+ * \brief Read a register of the loopback bus.
+ * \param[in]   read_params: Read access parameters.
+ * \param[out]  reg_value: Pointer to the register value.
+ * \param[out]  read_status: Pointer to the access status.
+ * \retval      none
+ *******************************************************************/
+void UNA_LOOPBACK_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status);
+
+/*!******************************************************************
+ * \fn void UNA_LOOPBACK_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status)
+ * \brief Write a register of the loopback bus.
+ * \param[in]   write_params: Write access parameters.
+ * \param[in]   reg_value: Register value.
+ * \param[in]   reg_mask: Bits to write.
+ * \param[out]  write_status: Pointer to the access status.
+ * \retval      none
+ *******************************************************************/
+void UNA_LOOPBACK_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_LOOPBACK_get_access_count(void)
+ * \brief Get the number of bus accesses since initialization.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of read and write accesses.
+ *******************************************************************/
+uint32_t UNA_LOOPBACK_get_access_count(void);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_LOOPBACK_H__ */
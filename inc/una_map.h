@@ -0,0 +1,110 @@
+/*
+ * una_map.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_MAP_H__
+#define __UNA_MAP_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA MAP macros ***/
+
+#define UNA_MAP_REGISTER_ADDRESS_NODE_ID    0x00
+
+/*** UNA MAP structures ***/
+
+/*!******************************************************************
+ * \enum UNA_MAP_status_t
+ * \brief UNA register map error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_MAP_SUCCESS = 0,
+    UNA_MAP_ERROR_NULL_PARAMETER,
+    UNA_MAP_ERROR_BOARD_ID,
+    UNA_MAP_ERROR_REGISTER_NUMBER,
+    // Last base value.
+    UNA_MAP_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_MAP_status_t;
+
+/*!******************************************************************
+ * \enum UNA_codec_t
+ * \brief UNA field representations.
+ *******************************************************************/
+typedef enum {
+    UNA_CODEC_RAW = 0,
+    UNA_CODEC_SECONDS,
+    UNA_CODEC_YEAR,
+    UNA_CODEC_TENTH_DEGREES,
+    UNA_CODEC_MV,
+    UNA_CODEC_UA,
+    UNA_CODEC_MW_MVA,
+    UNA_CODEC_MWH_MVAH,
+    UNA_CODEC_POWER_FACTOR,
+    UNA_CODEC_DBM,
+    UNA_CODEC_LAST
+} UNA_codec_t;
+
+/*!******************************************************************
+ * \struct UNA_map_field_t
+ * \brief Register map field descriptor.
+ *******************************************************************/
+typedef struct {
+    uint8_t reg_addr;
+    uint8_t offset;
+    uint8_t size_bits;
+    UNA_register_access_t access;
+    UNA_codec_t codec;
+} UNA_map_field_t;
+
+/*!******************************************************************
+ * \struct UNA_register_map_t
+ * \brief Board register map. Fields are sorted by register address.
+ *******************************************************************/
+typedef struct {
+    uint8_t register_number;
+    uint8_t field_number;
+    const UNA_map_field_t* field_table;
+} UNA_register_map_t;
+
+/*** UNA MAP global variables ***/
+
+extern const UNA_register_map_t* const UNA_REGISTER_MAP[UNA_BOARD_ID_LAST];
+
+/*** UNA MAP functions ***/
+
+/*!******************************************************************
+ * \fn UNA_MAP_status_t UNA_MAP_decode(const UNA_register_map_t* map, const uint32_t* reg_image, uint8_t reg_number, int32_t* physical_data)
+ * \brief Decode all fields of a register image in a single pass.
+ * \param[in]   map: Register map of the board.
+ * \param[in]   reg_image: Register values, indexed by register address.
+ * \param[in]   reg_number: Number of registers in the image.
+ * \param[out]  physical_data: Decoded values, indexed like the map fields.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_MAP_status_t UNA_MAP_decode(const UNA_register_map_t* map, const uint32_t* reg_image, uint8_t reg_number, int32_t* physical_data);
+
+/*!******************************************************************
+ * \fn UNA_MAP_status_t UNA_MAP_decode_board(UNA_board_id_t board_id, const uint32_t* reg_image, uint8_t reg_number, int32_t* physical_data)
+ * \brief Decode all fields of a register image with the built-in register map of the board.
+ * \param[in]   board_id: Board identifier.
+ * \param[in]   reg_image: Register values, indexed by register address.
+ * \param[in]   reg_number: Number of registers in the image.
+ * \param[out]  physical_data: Decoded values, indexed like the map fields.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_MAP_status_t UNA_MAP_decode_board(UNA_board_id_t board_id, const uint32_t* reg_image, uint8_t reg_number, int32_t* physical_data);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_MAP_H__ */
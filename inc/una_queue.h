@@ -0,0 +1,97 @@
+/*
+ * una_queue.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_QUEUE_H__
+#define __UNA_QUEUE_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA QUEUE structures ***/
+
+/*!******************************************************************
+ * \enum UNA_QUEUE_status_t
+ * \brief UNA queue error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_QUEUE_SUCCESS = 0,
+    UNA_QUEUE_ERROR_NULL_PARAMETER,
+    UNA_QUEUE_ERROR_SIZE,
+    UNA_QUEUE_ERROR_FULL,
+    UNA_QUEUE_ERROR_ACCESS_TYPE,
+    // Last base value.
+    UNA_QUEUE_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_QUEUE_status_t;
+
+/*!******************************************************************
+ * \struct UNA_transaction_t
+ * \brief Register access descriptor.
+ *******************************************************************/
+typedef struct {
+    UNA_access_type_t type;
+    UNA_access_parameters_t access_params;
+    uint32_t reg_value;
+    uint32_t reg_mask;
+    UNA_access_status_t status;
+} UNA_transaction_t;
+
+/*!******************************************************************
+ * \struct UNA_queue_t
+ * \brief Register access queue.
+ *******************************************************************/
+typedef struct {
+    UNA_transaction_t** transaction_table;
+    uint16_t size;
+    uint16_t count;
+    uint16_t bus_access_count;
+} UNA_queue_t;
+
+/*** UNA QUEUE functions ***/
+
+/*!******************************************************************
+ * \fn UNA_QUEUE_status_t UNA_QUEUE_init(UNA_queue_t* queue, UNA_transaction_t** transaction_table, uint16_t size)
+ * \brief Init a register access queue.
+ * \param[in]   queue: Queue to initialize.
+ * \param[in]   transaction_table: Transactions pointers storage, allocated by the caller.
+ * \param[in]   size: Maximum number of transactions.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_QUEUE_status_t UNA_QUEUE_init(UNA_queue_t* queue, UNA_transaction_t** transaction_table, uint16_t size);
+
+/*!******************************************************************
+ * \fn UNA_QUEUE_status_t UNA_QUEUE_add(UNA_queue_t* queue, UNA_transaction_t* transaction_list, uint16_t transaction_count)
+ * \brief Add register accesses to a queue. Transactions must remain allocated until the queue is executed.
+ * \param[in]   queue: Queue to fill.
+ * \param[in]   transaction_list: Transactions to add.
+ * \param[in]   transaction_count: Number of transactions to add.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_QUEUE_status_t UNA_QUEUE_add(UNA_queue_t* queue, UNA_transaction_t* transaction_list, uint16_t transaction_count);
+
+/*!******************************************************************
+ * \fn UNA_QUEUE_status_t UNA_QUEUE_execute(UNA_queue_t* queue, UNA_transport_t* transport)
+ * \brief Execute and empty a queue. Accesses are grouped by node, duplicate reads of a register are performed once,
+ * \brief and successive writes to a register are merged in a single write. Each transaction receives its own status.
+ * \param[in]   queue: Queue to execute.
+ * \param[in]   transport: Bus transport to use.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_QUEUE_status_t UNA_QUEUE_execute(UNA_queue_t* queue, UNA_transport_t* transport);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_QUEUE_H__ */
@@ -0,0 +1,159 @@
+/*
+ * una_registry.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_REGISTRY_H__
+#define __UNA_REGISTRY_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA REGISTRY macros ***/
+
+#define UNA_REGISTRY_PRESENCE_SIZE_WORDS    ((UNA_NODE_ADDRESS_LAST + MATH_U32_SIZE_BITS - 1) / MATH_U32_SIZE_BITS)
+
+/*** UNA REGISTRY structures ***/
+
+/*!******************************************************************
+ * \enum UNA_REGISTRY_status_t
+ * \brief UNA registry error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_REGISTRY_SUCCESS = 0,
+    UNA_REGISTRY_ERROR_NULL_PARAMETER,
+    UNA_REGISTRY_ERROR_NODE_ADDRESS,
+    UNA_REGISTRY_ERROR_BOARD_ID,
+    UNA_REGISTRY_ERROR_NODE_NOT_FOUND,
+    UNA_REGISTRY_ERROR_INDEX,
+    // Last base value.
+    UNA_REGISTRY_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_REGISTRY_status_t;
+
+/*!******************************************************************
+ * \struct UNA_packed_node_t
+ * \brief Node descriptor packed on 2 bytes.
+ *******************************************************************/
+typedef struct {
+    uint8_t address;
+    uint8_t board_id;
+} UNA_packed_node_t;
+
+/*!******************************************************************
+ * \struct UNA_registry_t
+ * \brief Indexed node registry.
+ *******************************************************************/
+typedef struct {
+    UNA_packed_node_t node[UNA_NODE_ADDRESS_LAST];
+    uint8_t slot[UNA_NODE_ADDRESS_LAST];
+    uint8_t board_next_address[UNA_NODE_ADDRESS_LAST];
+    uint8_t board_head_address[UNA_BOARD_ID_LAST];
+    uint8_t board_count[UNA_BOARD_ID_LAST];
+    uint32_t presence[UNA_REGISTRY_PRESENCE_SIZE_WORDS];
+    uint8_t count;
+} UNA_registry_t;
+
+/*** UNA REGISTRY functions ***/
+
+/*!******************************************************************
+ * \fn void UNA_REGISTRY_reset(UNA_registry_t* registry)
+ * \brief Reset a node registry in constant time.
+ * \param[in]   registry: Registry to reset.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_REGISTRY_reset(UNA_registry_t* registry);
+
+/*!******************************************************************
+ * \fn UNA_REGISTRY_status_t UNA_REGISTRY_add_node(UNA_registry_t* registry, UNA_node_t* node)
+ * \brief Add a node to a registry, or update its board identifier if the address is already present.
+ * \param[in]   registry: Registry to update.
+ * \param[in]   node: Node to add.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_add_node(UNA_registry_t* registry, UNA_node_t* node);
+
+/*!******************************************************************
+ * \fn UNA_REGISTRY_status_t UNA_REGISTRY_remove_node(UNA_registry_t* registry, UNA_node_address_t node_addr)
+ * \brief Remove a node from a registry.
+ * \param[in]   registry: Registry to update.
+ * \param[in]   node_addr: Address of the node to remove.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_remove_node(UNA_registry_t* registry, UNA_node_address_t node_addr);
+
+/*!******************************************************************
+ * \fn UNA_REGISTRY_status_t UNA_REGISTRY_get_node(UNA_registry_t* registry, UNA_node_address_t node_addr, UNA_node_t* node)
+ * \brief Get a node from its address.
+ * \param[in]   registry: Registry to read.
+ * \param[in]   node_addr: Address of the node to search.
+ * \param[out]  node: Pointer to the node descriptor.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_get_node(UNA_registry_t* registry, UNA_node_address_t node_addr, UNA_node_t* node);
+
+/*!******************************************************************
+ * \fn UNA_REGISTRY_status_t UNA_REGISTRY_get_node_by_index(UNA_registry_t* registry, uint8_t index, UNA_node_t* node)
+ * \brief Get a node from its index, in order to iterate over the present nodes only.
+ * \param[in]   registry: Registry to read.
+ * \param[in]   index: Node index, from 0 to (count - 1).
+ * \param[out]  node: Pointer to the node descriptor.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_get_node_by_index(UNA_registry_t* registry, uint8_t index, UNA_node_t* node);
+
+/*!******************************************************************
+ * \fn UNA_REGISTRY_status_t UNA_REGISTRY_get_board_nodes(UNA_registry_t* registry, UNA_board_id_t board_id, UNA_node_address_t* node_addr_list, uint8_t node_addr_list_size, uint8_t* node_count)
+ * \brief Get the addresses of all nodes of a given board.
+ * \param[in]   registry: Registry to read.
+ * \param[in]   board_id: Board identifier to search.
+ * \param[in]   node_addr_list_size: Maximum number of addresses to write.
+ * \param[out]  node_addr_list: Pointer to the addresses list.
+ * \param[out]  node_count: Pointer to the number of nodes of the board.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_get_board_nodes(UNA_registry_t* registry, UNA_board_id_t board_id, UNA_node_address_t* node_addr_list, uint8_t node_addr_list_size, uint8_t* node_count);
+
+/*!******************************************************************
+ * \fn UNA_REGISTRY_status_t UNA_REGISTRY_import_node_list(UNA_registry_t* registry, UNA_node_list_t* node_list)
+ * \brief Fill a registry from a node list. The whole list is checked first: the registry is not modified if any node is invalid.
+ * \param[in]   registry: Registry to fill.
+ * \param[in]   node_list: Node list to import.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_import_node_list(UNA_registry_t* registry, UNA_node_list_t* node_list);
+
+/*!******************************************************************
+ * \fn UNA_REGISTRY_status_t UNA_REGISTRY_export_node_list(UNA_registry_t* registry, UNA_node_list_t* node_list)
+ * \brief Fill a node list from a registry.
+ * \param[in]   registry: Registry to export.
+ * \param[out]  node_list: Node list to fill.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_export_node_list(UNA_registry_t* registry, UNA_node_list_t* node_list);
+
+/*!******************************************************************
+ * \fn uint8_t UNA_REGISTRY_is_node_present(UNA_registry_t* registry, UNA_node_address_t node_addr)
+ * \brief Check if a node is present in a registry.
+ * \param[in]   registry: Registry to read.
+ * \param[in]   node_addr: Address of the node to check.
+ * \param[out]  none
+ * \retval      0 if the node is absent, 1 otherwise.
+ *******************************************************************/
+uint8_t UNA_REGISTRY_is_node_present(UNA_registry_t* registry, UNA_node_address_t node_addr);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_REGISTRY_H__ */
@@ -0,0 +1,119 @@
+/*
+ * una_reply.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_REPLY_H__
+#define __UNA_REPLY_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA REPLY structures ***/
+
+/*!******************************************************************
+ * \enum UNA_REPLY_status_t
+ * \brief UNA reply parser error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_REPLY_SUCCESS = 0,
+    UNA_REPLY_ERROR_NULL_PARAMETER,
+    UNA_REPLY_ERROR_NODE_ADDRESS,
+    UNA_REPLY_ERROR_ACCESS_TYPE,
+    UNA_REPLY_ERROR_REPLY_TYPE,
+    UNA_REPLY_ERROR_NOT_COMPLETE,
+    // Last base value.
+    UNA_REPLY_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_REPLY_status_t;
+
+/*!******************************************************************
+ * \struct UNA_reply_parser_t
+ * \brief Resumable reply parser of a bus channel. The state size is constant, received bytes are never stored.
+ *******************************************************************/
+typedef struct {
+    uint32_t reg_value;
+    UNA_access_status_t access_status;
+    UNA_node_address_t node_addr;
+    UNA_reply_type_t reply_type;
+    uint8_t state;
+    uint8_t index;
+#ifdef UNA_LIB_USE_TRACE
+    uint32_t trace_timestamp;
+#endif
+} UNA_reply_parser_t;
+
+/*** UNA REPLY functions ***/
+
+/*!******************************************************************
+ * \fn UNA_REPLY_status_t UNA_REPLY_start(UNA_reply_parser_t* parser, UNA_access_type_t access_type, UNA_access_parameters_t* access_params)
+ * \brief Arm the parser of a channel for the reply to an access. A UNA_REPLY_TYPE_NONE access is complete immediately.
+ * \param[in]   parser: Channel parser.
+ * \param[in]   access_type: Type of the pending access.
+ * \param[in]   access_params: Parameters of the pending access (node address and expected reply type).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_REPLY_status_t UNA_REPLY_start(UNA_reply_parser_t* parser, UNA_access_type_t access_type, UNA_access_parameters_t* access_params);
+
+/*!******************************************************************
+ * \fn uint8_t UNA_REPLY_parse_byte(UNA_reply_parser_t* parser, uint8_t byte)
+ * \brief Feed a received byte to the parser, typically from the UART interrupt.
+ * \brief Frames sent to other nodes and replies of other nodes are skipped. The parser_error and error_received flags are set as soon as the frame is known to be bad.
+ * \param[in]   parser: Channel parser.
+ * \param[in]   byte: Received byte.
+ * \param[out]  none
+ * \retval      1 if the reply is complete, 0 otherwise.
+ *******************************************************************/
+uint8_t UNA_REPLY_parse_byte(UNA_reply_parser_t* parser, uint8_t byte);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_REPLY_parse_buffer(UNA_reply_parser_t* parser, uint8_t* data, uint32_t size)
+ * \brief Feed a received chunk to the parser, typically a DMA half buffer or a host read. Bytes which can not belong to the reply are skipped one word at a time.
+ * \param[in]   parser: Channel parser.
+ * \param[in]   data: Received bytes.
+ * \param[in]   size: Number of received bytes.
+ * \param[out]  none
+ * \retval      Number of consumed bytes: parsing stops after the end of the reply, the remaining bytes belong to the next one.
+ *******************************************************************/
+uint32_t UNA_REPLY_parse_buffer(UNA_reply_parser_t* parser, uint8_t* data, uint32_t size);
+
+/*!******************************************************************
+ * \fn uint8_t UNA_REPLY_is_complete(UNA_reply_parser_t* parser)
+ * \brief Check if the reply has been completely received.
+ * \param[in]   parser: Channel parser.
+ * \param[out]  none
+ * \retval      1 if the reply is complete, 0 otherwise.
+ *******************************************************************/
+uint8_t UNA_REPLY_is_complete(UNA_reply_parser_t* parser);
+
+/*!******************************************************************
+ * \fn UNA_REPLY_status_t UNA_REPLY_get_access_status(UNA_reply_parser_t* parser, UNA_access_status_t* access_status)
+ * \brief Get the current access status. The error flags can be read before the reply is complete.
+ * \param[in]   parser: Channel parser.
+ * \param[out]  access_status: Pointer to the access status.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_REPLY_status_t UNA_REPLY_get_access_status(UNA_reply_parser_t* parser, UNA_access_status_t* access_status);
+
+/*!******************************************************************
+ * \fn UNA_REPLY_status_t UNA_REPLY_get_result(UNA_reply_parser_t* parser, uint32_t* reg_value, UNA_access_status_t* access_status)
+ * \brief Get the result of a complete reply.
+ * \param[in]   parser: Channel parser.
+ * \param[out]  reg_value: Pointer to the decoded register value, 0 if the reply carries no value.
+ * \param[out]  access_status: Pointer to the access status.
+ * \retval      Function execution status, UNA_REPLY_ERROR_NOT_COMPLETE if the reply end has not been received yet.
+ *******************************************************************/
+UNA_REPLY_status_t UNA_REPLY_get_result(UNA_reply_parser_t* parser, uint32_t* reg_value, UNA_access_status_t* access_status);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_REPLY_H__ */
@@ -0,0 +1,161 @@
+/*
+ * una_rtt.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_RTT_H__
+#define __UNA_RTT_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA RTT structures ***/
+
+/*!******************************************************************
+ * \enum UNA_RTT_status_t
+ * \brief UNA round-trip time tracker error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_RTT_SUCCESS = 0,
+    UNA_RTT_ERROR_NULL_PARAMETER,
+    UNA_RTT_ERROR_CONFIGURATION,
+    UNA_RTT_ERROR_NODE_ADDRESS,
+    UNA_RTT_ERROR_BACKOFF,
+    // Last base value.
+    UNA_RTT_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_RTT_status_t;
+
+/*!******************************************************************
+ * \struct UNA_rtt_configuration_t
+ * \brief Round-trip time tracker configuration.
+ *******************************************************************/
+typedef struct {
+    uint32_t timeout_min_ms;
+    uint32_t timeout_max_ms;
+    uint32_t timeout_default_ms;
+    uint8_t percentile;
+    uint8_t backoff_threshold;
+    uint32_t backoff_period_ms;
+    uint32_t backoff_period_max_ms;
+} UNA_rtt_configuration_t;
+
+/*!******************************************************************
+ * \struct UNA_rtt_node_t
+ * \brief Round-trip time statistics of a node, in fixed point.
+ *******************************************************************/
+typedef struct {
+    uint32_t srtt_x8;
+    uint32_t rttvar_x4;
+    uint32_t percentile_x16;
+    uint32_t next_access_ms;
+    uint16_t sample_count;
+    uint8_t timeout_count;
+    uint8_t backoff_level;
+} UNA_rtt_node_t;
+
+/*!******************************************************************
+ * \struct UNA_rtt_statistics_t
+ * \brief Learned round-trip time values of a node.
+ *******************************************************************/
+typedef struct {
+    uint32_t srtt_ms;
+    uint32_t rttvar_ms;
+    uint32_t percentile_ms;
+    uint32_t timeout_ms;
+    uint16_t sample_count;
+    uint8_t timeout_count;
+    uint8_t backoff;
+} UNA_rtt_statistics_t;
+
+/*!******************************************************************
+ * \struct UNA_rtt_t
+ * \brief Round-trip time tracker.
+ *******************************************************************/
+typedef struct {
+    UNA_rtt_node_t* node_table;
+    UNA_rtt_configuration_t configuration;
+    uint32_t percentile_up_factor_x16;
+} UNA_rtt_t;
+
+/*** UNA RTT functions ***/
+
+/*!******************************************************************
+ * \fn UNA_RTT_status_t UNA_RTT_init(UNA_rtt_t* rtt, UNA_rtt_node_t* node_table, UNA_rtt_configuration_t* configuration)
+ * \brief Init a round-trip time tracker. All nodes use the default timeout until their first reply.
+ * \param[in]   rtt: Tracker to initialize.
+ * \param[in]   node_table: Nodes statistics storage, allocated by the caller with UNA_NODE_ADDRESS_LAST elements.
+ * \param[in]   configuration: Timeout bounds, tracked percentile (50 to 99) and backoff of the nodes which do not reply.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_RTT_status_t UNA_RTT_init(UNA_rtt_t* rtt, UNA_rtt_node_t* node_table, UNA_rtt_configuration_t* configuration);
+
+/*!******************************************************************
+ * \fn UNA_RTT_status_t UNA_RTT_get_timeout(UNA_rtt_t* rtt, UNA_node_address_t node_addr, uint32_t now_ms, uint32_t* timeout_ms)
+ * \brief Compute the reply timeout of a node: the largest of the smoothed RTT plus 4 deviations and the tracked percentile, doubled after a timeout.
+ * \param[in]   rtt: Tracker to use.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  timeout_ms: Pointer to the suggested reply timeout.
+ * \retval      Function execution status, UNA_RTT_ERROR_BACKOFF if the node should not be accessed yet.
+ *******************************************************************/
+UNA_RTT_status_t UNA_RTT_get_timeout(UNA_rtt_t* rtt, UNA_node_address_t node_addr, uint32_t now_ms, uint32_t* timeout_ms);
+
+/*!******************************************************************
+ * \fn UNA_RTT_status_t UNA_RTT_apply(UNA_rtt_t* rtt, UNA_access_parameters_t* access_params, uint32_t now_ms)
+ * \brief Set the reply timeout of an access to the suggested value. Accesses without reply are not modified.
+ * \param[in]   rtt: Tracker to use.
+ * \param[in]   access_params: Access parameters to update.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  none
+ * \retval      Function execution status, UNA_RTT_ERROR_BACKOFF if the node should not be accessed yet.
+ *******************************************************************/
+UNA_RTT_status_t UNA_RTT_apply(UNA_rtt_t* rtt, UNA_access_parameters_t* access_params, uint32_t now_ms);
+
+/*!******************************************************************
+ * \fn UNA_RTT_status_t UNA_RTT_update(UNA_rtt_t* rtt, UNA_node_address_t node_addr, UNA_access_status_t access_status, uint32_t rtt_ms, uint32_t now_ms)
+ * \brief Record the result of an access. Only successful replies are sampled, consecutive reply timeouts put the node in backoff.
+ * \param[in]   rtt: Tracker to update.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   access_status: Status of the access.
+ * \param[in]   rtt_ms: Time between the command and the reply.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_RTT_status_t UNA_RTT_update(UNA_rtt_t* rtt, UNA_node_address_t node_addr, UNA_access_status_t access_status, uint32_t rtt_ms, uint32_t now_ms);
+
+/*!******************************************************************
+ * \fn UNA_RTT_status_t UNA_RTT_get_statistics(UNA_rtt_t* rtt, UNA_node_address_t node_addr, uint32_t now_ms, UNA_rtt_statistics_t* statistics)
+ * \brief Read the learned values of a node.
+ * \param[in]   rtt: Tracker to read.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  statistics: Pointer to the node statistics.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_RTT_status_t UNA_RTT_get_statistics(UNA_rtt_t* rtt, UNA_node_address_t node_addr, uint32_t now_ms, UNA_rtt_statistics_t* statistics);
+
+/*!******************************************************************
+ * \fn UNA_RTT_status_t UNA_RTT_get_cycle_time(UNA_rtt_t* rtt, UNA_node_list_t* node_list, uint32_t now_ms, uint32_t* cycle_time_ms)
+ * \brief Compute the worst case duration of a poll cycle, with one access to each node of the list which is not in backoff.
+ * \param[in]   rtt: Tracker to use.
+ * \param[in]   node_list: Nodes to poll.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  cycle_time_ms: Pointer to the sum of the suggested timeouts.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_RTT_status_t UNA_RTT_get_cycle_time(UNA_rtt_t* rtt, UNA_node_list_t* node_list, uint32_t now_ms, uint32_t* cycle_time_ms);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_RTT_H__ */
@@ -0,0 +1,137 @@
+/*
+ * una_shared_registry.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_SHARED_REGISTRY_H__
+#define __UNA_SHARED_REGISTRY_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+#include "una_registry.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA SHARED REGISTRY structures ***/
+
+/*!******************************************************************
+ * \enum UNA_SHARED_REGISTRY_status_t
+ * \brief UNA shared registry error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_SHARED_REGISTRY_SUCCESS = 0,
+    UNA_SHARED_REGISTRY_ERROR_NULL_PARAMETER,
+    UNA_SHARED_REGISTRY_ERROR_SHARD_INDEX,
+    UNA_SHARED_REGISTRY_ERROR_NODE_ADDRESS,
+    UNA_SHARED_REGISTRY_ERROR_NODE_NOT_FOUND,
+    UNA_SHARED_REGISTRY_ERROR_NODE_LIST,
+    // Last base value.
+    UNA_SHARED_REGISTRY_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_SHARED_REGISTRY_status_t;
+
+/*!******************************************************************
+ * \struct UNA_shared_registry_shard_t
+ * \brief Double-buffered registry of a bus segment. The version parity gives the published buffer.
+ *******************************************************************/
+typedef struct {
+    volatile uint32_t version;
+    UNA_registry_t buffer[2];
+} UNA_shared_registry_shard_t;
+
+/*!******************************************************************
+ * \struct UNA_shared_registry_t
+ * \brief Node registry shared between threads, with one independent address space per bus segment.
+ *******************************************************************/
+typedef struct {
+    UNA_shared_registry_shard_t* shard_table;
+    uint8_t shard_number;
+} UNA_shared_registry_t;
+
+/*** UNA SHARED REGISTRY functions ***/
+
+/*!******************************************************************
+ * \fn UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_init(UNA_shared_registry_t* registry, UNA_shared_registry_shard_t* shard_table, uint8_t shard_number)
+ * \brief Init a shared registry. All shards are empty after initialization.
+ * \param[in]   registry: Registry to initialize.
+ * \param[in]   shard_table: Shards storage, allocated by the caller with one shard per bus segment.
+ * \param[in]   shard_number: Number of shards.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_init(UNA_shared_registry_t* registry, UNA_shared_registry_shard_t* shard_table, uint8_t shard_number);
+
+/*!******************************************************************
+ * \fn UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_publish_node_list(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_node_list_t* node_list)
+ * \brief Replace the nodes of a shard by a new list in a single step. Readers see either the previous or the new list.
+ * \brief A shard must be updated by a single writer thread at a time.
+ * \param[in]   registry: Registry to update.
+ * \param[in]   shard_index: Bus segment index.
+ * \param[in]   node_list: New nodes list.
+ * \param[out]  none
+ * \retval      Function execution status, the published nodes are unchanged on error.
+ *******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_publish_node_list(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_node_list_t* node_list);
+
+/*!******************************************************************
+ * \fn UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_begin_update(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_registry_t** registry_copy)
+ * \brief Get a private copy of the published nodes of a shard, to be modified with the UNA_REGISTRY functions and published with UNA_SHARED_REGISTRY_commit().
+ * \param[in]   registry: Registry to update.
+ * \param[in]   shard_index: Bus segment index.
+ * \param[out]  registry_copy: Pointer to the writer copy.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_begin_update(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_registry_t** registry_copy);
+
+/*!******************************************************************
+ * \fn UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_commit(UNA_shared_registry_t* registry, uint8_t shard_index)
+ * \brief Publish the writer copy of a shard.
+ * \param[in]   registry: Registry to update.
+ * \param[in]   shard_index: Bus segment index.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_commit(UNA_shared_registry_t* registry, uint8_t shard_index);
+
+/*!******************************************************************
+ * \fn UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_get_version(UNA_shared_registry_t* registry, uint8_t shard_index, uint32_t* version)
+ * \brief Get the version of a shard, incremented on each publication, so that readers only copy the nodes when they changed.
+ * \param[in]   registry: Registry to read.
+ * \param[in]   shard_index: Bus segment index.
+ * \param[out]  version: Pointer to the shard version.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_get_version(UNA_shared_registry_t* registry, uint8_t shard_index, uint32_t* version);
+
+/*!******************************************************************
+ * \fn UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_get_node(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_node_address_t node_addr, UNA_node_t* node)
+ * \brief Get a published node from its address, without lock. Readers are lock-free but not wait-free: the read is retried as long as publications occur during it.
+ * \param[in]   registry: Registry to read.
+ * \param[in]   shard_index: Bus segment index.
+ * \param[in]   node_addr: Address of the node to search.
+ * \param[out]  node: Pointer to the node descriptor.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_get_node(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_node_address_t node_addr, UNA_node_t* node);
+
+/*!******************************************************************
+ * \fn UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_snapshot(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_node_list_t* node_list, uint32_t* version)
+ * \brief Copy the published nodes of a shard without lock. The new list is built aside by the writer, so the copy is only retried if a publication occurs during the copy.
+ * \brief Readers are lock-free but not wait-free: a writer publishing continuously can delay the copy without bound.
+ * \param[in]   registry: Registry to read.
+ * \param[in]   shard_index: Bus segment index.
+ * \param[out]  node_list: Node list to fill.
+ * \param[out]  version: Optional pointer to the version of the copied nodes.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_snapshot(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_node_list_t* node_list, uint32_t* version);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_SHARED_REGISTRY_H__ */
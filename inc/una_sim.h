@@ -0,0 +1,171 @@
+/*
+ * una_sim.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_SIM_H__
+#define __UNA_SIM_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+#include "una_async.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA SIM macros ***/
+
+#define UNA_SIM_REGISTER_NUMBER     16
+#define UNA_SIM_BUS_NUMBER_MAX      4
+
+/*** UNA SIM structures ***/
+
+/*!******************************************************************
+ * \enum UNA_SIM_status_t
+ * \brief UNA node simulator error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_SIM_SUCCESS = 0,
+    UNA_SIM_ERROR_NULL_PARAMETER,
+    UNA_SIM_ERROR_NODE_ADDRESS,
+    UNA_SIM_ERROR_BUS_INDEX,
+    UNA_SIM_ERROR_BOARD_ID,
+    UNA_SIM_ERROR_RATE,
+    // Last base value.
+    UNA_SIM_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_SIM_status_t;
+
+/*!******************************************************************
+ * \enum UNA_sim_register_t
+ * \brief Simulated nodes registers map.
+ *******************************************************************/
+typedef enum {
+    UNA_SIM_REGISTER_NODE_ID = 0,
+    UNA_SIM_REGISTER_CONTROL,
+    UNA_SIM_REGISTER_ANALOG_DATA_0,
+    UNA_SIM_REGISTER_ANALOG_DATA_1,
+    UNA_SIM_REGISTER_ANALOG_DATA_2,
+    UNA_SIM_REGISTER_ANALOG_DATA_3,
+    UNA_SIM_REGISTER_LAST
+} UNA_sim_register_t;
+
+/*!******************************************************************
+ * \struct UNA_sim_faults_t
+ * \brief Simulated node faults injection rates, in percent of the accesses.
+ *******************************************************************/
+typedef struct {
+    uint8_t reply_timeout_percent;
+    uint8_t error_received_percent;
+    uint8_t parser_error_percent;
+} UNA_sim_faults_t;
+
+/*!******************************************************************
+ * \struct UNA_sim_node_t
+ * \brief Simulated node.
+ *******************************************************************/
+typedef struct {
+    UNA_board_id_t board_id;
+    uint8_t bus_index;
+    uint32_t latency_ms;
+    UNA_sim_faults_t faults;
+    uint32_t reg[UNA_SIM_REGISTER_NUMBER];
+} UNA_sim_node_t;
+
+/*** UNA SIM global variables ***/
+
+extern const UNA_transport_t UNA_SIM_TRANSPORT;
+extern const UNA_async_transport_t UNA_SIM_ASYNC_TRANSPORT;
+
+/*** UNA SIM functions ***/
+
+/*!******************************************************************
+ * \fn UNA_SIM_status_t UNA_SIM_init(UNA_sim_node_t* node_table, uint32_t seed)
+ * \brief Init the node simulator. All nodes are absent after initialization.
+ * \param[in]   node_table: Simulated nodes storage, allocated by the caller with UNA_NODE_ADDRESS_LAST elements.
+ * \param[in]   seed: Seed of the faults injection and measurements random generator.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SIM_status_t UNA_SIM_init(UNA_sim_node_t* node_table, uint32_t seed);
+
+/*!******************************************************************
+ * \fn UNA_SIM_status_t UNA_SIM_add_node(UNA_node_address_t node_addr, UNA_board_id_t board_id, uint8_t bus_index, uint32_t latency_ms)
+ * \brief Connect a simulated board to the virtual bus.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   board_id: Simulated board.
+ * \param[in]   bus_index: Bus segment of the node.
+ * \param[in]   latency_ms: Reply delay of the node.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SIM_status_t UNA_SIM_add_node(UNA_node_address_t node_addr, UNA_board_id_t board_id, uint8_t bus_index, uint32_t latency_ms);
+
+/*!******************************************************************
+ * \fn UNA_SIM_status_t UNA_SIM_populate(uint8_t nodes_per_range, uint8_t bus_number, uint32_t latency_ms)
+ * \brief Connect all single address boards, and the given number of boards in each address range.
+ * \param[in]   nodes_per_range: Number of boards of each address range.
+ * \param[in]   bus_number: Number of bus segments on which nodes are spread.
+ * \param[in]   latency_ms: Reply delay of the nodes.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SIM_status_t UNA_SIM_populate(uint8_t nodes_per_range, uint8_t bus_number, uint32_t latency_ms);
+
+/*!******************************************************************
+ * \fn UNA_SIM_status_t UNA_SIM_set_faults(UNA_node_address_t node_addr, UNA_sim_faults_t* faults)
+ * \brief Configure the faults injection of a node.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   faults: Faults injection rates.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_SIM_status_t UNA_SIM_set_faults(UNA_node_address_t node_addr, UNA_sim_faults_t* faults);
+
+/*!******************************************************************
+ * \fn void UNA_SIM_set_time_ms(uint32_t now_ms)
+ * \brief Set the current time of the virtual bus, used by the asynchronous transport.
+ * \param[in]   now_ms: Current time.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_SIM_set_time_ms(uint32_t now_ms);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_SIM_get_bus_time_ms(void)
+ * \brief Get the cumulated bus time spent by the synchronous transport, including reply timeouts.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Cumulated bus time in ms.
+ *******************************************************************/
+uint32_t UNA_SIM_get_bus_time_ms(void);
+
+/*!******************************************************************
+ * \fn void UNA_SIM_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status)
+ * \brief Read a register of a simulated node. The synchronous transport sees the nodes of all bus segments.
+ * \param[in]   read_params: Read access parameters.
+ * \param[out]  reg_value: Pointer to the register value.
+ * \param[out]  read_status: Pointer to the access status.
+ * \retval      none
+ *******************************************************************/
+void UNA_SIM_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status);
+
+/*!******************************************************************
+ * \fn void UNA_SIM_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status)
+ * \brief Write a register of a simulated node. The synchronous transport sees the nodes of all bus segments.
+ * \param[in]   write_params: Write access parameters.
+ * \param[in]   reg_value: Register value.
+ * \param[in]   reg_mask: Bits to write.
+ * \param[out]  write_status: Pointer to the access status.
+ * \retval      none
+ *******************************************************************/
+void UNA_SIM_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_SIM_H__ */
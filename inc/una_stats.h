@@ -0,0 +1,178 @@
+/*
+ * una_stats.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_STATS_H__
+#define __UNA_STATS_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA STATS macros ***/
+
+#define UNA_STATS_KEY_NONE  0xFFFF
+
+/*** UNA STATS structures ***/
+
+/*!******************************************************************
+ * \enum UNA_STATS_status_t
+ * \brief UNA access statistics error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_STATS_SUCCESS = 0,
+    UNA_STATS_ERROR_NULL_PARAMETER,
+    UNA_STATS_ERROR_SIZE,
+    UNA_STATS_ERROR_NODE_ADDRESS,
+    UNA_STATS_ERROR_FULL,
+    UNA_STATS_ERROR_MISS,
+    // Last base value.
+    UNA_STATS_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_STATS_status_t;
+
+/*!******************************************************************
+ * \enum UNA_stats_counter_t
+ * \brief Access statistics counters.
+ *******************************************************************/
+typedef enum {
+    UNA_STATS_COUNTER_READ_SUCCESS = 0,
+    UNA_STATS_COUNTER_WRITE_SUCCESS,
+    UNA_STATS_COUNTER_REPLY_TIMEOUT,
+    UNA_STATS_COUNTER_SEQUENCE_TIMEOUT,
+    UNA_STATS_COUNTER_PARSER_ERROR,
+    UNA_STATS_COUNTER_ERROR_RECEIVED,
+    UNA_STATS_COUNTER_LAST
+} UNA_stats_counter_t;
+
+/*!******************************************************************
+ * \struct UNA_stats_counters_t
+ * \brief Access statistics counters set. Bytes counters are 64 bits wide so that they do not wrap on a long running bus.
+ *******************************************************************/
+typedef struct {
+    uint32_t count[UNA_STATS_COUNTER_LAST];
+    uint64_t tx_bytes;
+    uint64_t rx_bytes;
+} UNA_stats_counters_t;
+
+/*!******************************************************************
+ * \struct UNA_stats_entry_t
+ * \brief Access statistics entry.
+ *******************************************************************/
+typedef struct {
+    volatile uint32_t sequence;
+    volatile uint16_t key;
+    volatile uint32_t count[UNA_STATS_COUNTER_LAST];
+    volatile uint64_t tx_bytes;
+    volatile uint64_t rx_bytes;
+} UNA_stats_entry_t;
+
+/*!******************************************************************
+ * \struct UNA_stats_record_t
+ * \brief Exported register statistics.
+ *******************************************************************/
+typedef struct {
+    UNA_node_address_t node_addr;
+    uint8_t reg_addr;
+    UNA_stats_counters_t counters;
+} UNA_stats_record_t;
+
+/*!******************************************************************
+ * \struct UNA_stats_t
+ * \brief Access statistics.
+ *******************************************************************/
+typedef struct {
+    UNA_stats_entry_t total;
+    UNA_stats_entry_t* node_table;
+    UNA_stats_entry_t* register_table;
+    uint16_t register_table_size;
+} UNA_stats_t;
+
+/*** UNA STATS functions ***/
+
+/*!******************************************************************
+ * \fn UNA_STATS_status_t UNA_STATS_init(UNA_stats_t* stats, UNA_stats_entry_t* node_table, UNA_stats_entry_t* register_table, uint16_t register_table_size)
+ * \brief Init access statistics.
+ * \param[in]   stats: Statistics to initialize.
+ * \param[in]   node_table: Optional per-node counters storage, allocated by the caller with UNA_NODE_ADDRESS_LAST elements.
+ * \param[in]   register_table: Optional per-register counters storage, allocated by the caller.
+ * \param[in]   register_table_size: Number of registers entries, must be a power of 2 (or 0 without per-register counters).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_STATS_status_t UNA_STATS_init(UNA_stats_t* stats, UNA_stats_entry_t* node_table, UNA_stats_entry_t* register_table, uint16_t register_table_size);
+
+/*!******************************************************************
+ * \fn void UNA_STATS_reset(UNA_stats_t* stats)
+ * \brief Clear all counters. Must not be called while readers are running.
+ * \param[in]   stats: Statistics to reset.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_STATS_reset(UNA_stats_t* stats);
+
+/*!******************************************************************
+ * \fn UNA_STATS_status_t UNA_STATS_record(UNA_stats_t* stats, UNA_access_parameters_t* access_params, UNA_access_status_t access_status, uint32_t tx_bytes, uint32_t rx_bytes)
+ * \brief Count the outcome of an access. Lock-free and bounded, can be called from an interrupt, but from a single context per statistics instance.
+ * \param[in]   stats: Statistics to update.
+ * \param[in]   access_params: Parameters of the access.
+ * \param[in]   access_status: Status of the access.
+ * \param[in]   tx_bytes: Number of bytes sent on the bus.
+ * \param[in]   rx_bytes: Number of bytes received from the bus.
+ * \param[out]  none
+ * \retval      Function execution status, UNA_STATS_ERROR_FULL if the register could not be counted (node and total counters are still updated).
+ *******************************************************************/
+UNA_STATS_status_t UNA_STATS_record(UNA_stats_t* stats, UNA_access_parameters_t* access_params, UNA_access_status_t access_status, uint32_t tx_bytes, uint32_t rx_bytes);
+
+/*!******************************************************************
+ * \fn UNA_STATS_status_t UNA_STATS_read_total(UNA_stats_t* stats, UNA_stats_counters_t* counters)
+ * \brief Read a consistent snapshot of the counters of all accesses, without blocking the recording context.
+ * \param[in]   stats: Statistics to read.
+ * \param[out]  counters: Pointer to the counters.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_STATS_status_t UNA_STATS_read_total(UNA_stats_t* stats, UNA_stats_counters_t* counters);
+
+/*!******************************************************************
+ * \fn UNA_STATS_status_t UNA_STATS_read_node(UNA_stats_t* stats, UNA_node_address_t node_addr, UNA_stats_counters_t* counters)
+ * \brief Read a consistent snapshot of the counters of a node, without blocking the recording context.
+ * \param[in]   stats: Statistics to read.
+ * \param[in]   node_addr: Node address.
+ * \param[out]  counters: Pointer to the counters.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_STATS_status_t UNA_STATS_read_node(UNA_stats_t* stats, UNA_node_address_t node_addr, UNA_stats_counters_t* counters);
+
+/*!******************************************************************
+ * \fn UNA_STATS_status_t UNA_STATS_read_register(UNA_stats_t* stats, UNA_node_address_t node_addr, uint8_t reg_addr, UNA_stats_counters_t* counters)
+ * \brief Read a consistent snapshot of the counters of a register, without blocking the recording context.
+ * \param[in]   stats: Statistics to read.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   reg_addr: Register address.
+ * \param[out]  counters: Pointer to the counters.
+ * \retval      Function execution status, UNA_STATS_ERROR_MISS if the register has never been accessed.
+ *******************************************************************/
+UNA_STATS_status_t UNA_STATS_read_register(UNA_stats_t* stats, UNA_node_address_t node_addr, uint8_t reg_addr, UNA_stats_counters_t* counters);
+
+/*!******************************************************************
+ * \fn UNA_STATS_status_t UNA_STATS_export(UNA_stats_t* stats, UNA_stats_record_t* record_table, uint16_t record_table_size, uint16_t* record_count)
+ * \brief Export the counters of all accessed registers. Each record is a consistent snapshot of its register.
+ * \param[in]   stats: Statistics to read.
+ * \param[in]   record_table_size: Maximum number of records.
+ * \param[out]  record_table: Records storage.
+ * \param[out]  record_count: Pointer to the number of exported records.
+ * \retval      Function execution status, UNA_STATS_ERROR_FULL if the records table is too small.
+ *******************************************************************/
+UNA_STATS_status_t UNA_STATS_export(UNA_stats_t* stats, UNA_stats_record_t* record_table, uint16_t record_table_size, uint16_t* record_count);
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_STATS_H__ */
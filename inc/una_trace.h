@@ -0,0 +1,157 @@
+/*
+ * una_trace.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_TRACE_H__
+#define __UNA_TRACE_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA TRACE macros ***/
+
+#ifdef UNA_LIB_USE_TRACE
+#define UNA_TRACE_START(timestamp)                      (timestamp) = UNA_TRACE_get_timestamp()
+#define UNA_TRACE_STOP(stage, node_addr, timestamp)     UNA_TRACE_record(stage, node_addr, timestamp)
+#else
+#define UNA_TRACE_START(timestamp)
+#define UNA_TRACE_STOP(stage, node_addr, timestamp)
+#endif
+
+#define UNA_TRACE_HISTOGRAM_BUCKET_NUMBER               33
+
+/*** UNA TRACE structures ***/
+
+/*!******************************************************************
+ * \enum UNA_TRACE_status_t
+ * \brief UNA trace error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    UNA_TRACE_SUCCESS = 0,
+    UNA_TRACE_ERROR_NULL_PARAMETER,
+    UNA_TRACE_ERROR_NODE_ADDRESS,
+    UNA_TRACE_ERROR_STAGE,
+    // Last base value.
+    UNA_TRACE_ERROR_BASE_LAST = ERROR_BASE_STEP
+} UNA_TRACE_status_t;
+
+/*!******************************************************************
+ * \enum UNA_trace_stage_t
+ * \brief Stages of a register access.
+ *******************************************************************/
+typedef enum {
+    UNA_TRACE_STAGE_QUEUE = 0,
+    UNA_TRACE_STAGE_TX,
+    UNA_TRACE_STAGE_TURNAROUND,
+    UNA_TRACE_STAGE_REPLY,
+    UNA_TRACE_STAGE_PARSE,
+    UNA_TRACE_STAGE_DECODE,
+    UNA_TRACE_STAGE_TOTAL,
+    UNA_TRACE_STAGE_LAST
+} UNA_trace_stage_t;
+
+/*!******************************************************************
+ * \fn UNA_TRACE_get_timestamp_cb_t
+ * \brief Free running timestamp function, typically a cycle counter on MCUs or clock_gettime() on Linux.
+ *******************************************************************/
+typedef uint32_t (*UNA_TRACE_get_timestamp_cb_t)(void);
+
+/*!******************************************************************
+ * \struct UNA_trace_histogram_t
+ * \brief Log2 scale histogram: bucket n counts the durations between 2^(n-1) and 2^n - 1 ticks.
+ *******************************************************************/
+typedef struct {
+    uint32_t bucket[UNA_TRACE_HISTOGRAM_BUCKET_NUMBER];
+    uint32_t count;
+    uint32_t max;
+} UNA_trace_histogram_t;
+
+/*!******************************************************************
+ * \struct UNA_trace_summary_t
+ * \brief Stage duration summary, in timestamp ticks.
+ *******************************************************************/
+typedef struct {
+    uint32_t count;
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t max;
+} UNA_trace_summary_t;
+
+#ifdef UNA_LIB_USE_TRACE
+
+/*** UNA TRACE functions ***/
+
+/*!******************************************************************
+ * \fn UNA_TRACE_status_t UNA_TRACE_init(UNA_TRACE_get_timestamp_cb_t get_timestamp, UNA_trace_histogram_t* histogram_table, UNA_trace_histogram_t* node_histogram_table)
+ * \brief Init the access stages tracing.
+ * \param[in]   get_timestamp: Timestamp function.
+ * \param[in]   histogram_table: Histograms of all nodes, allocated by the caller with UNA_TRACE_STAGE_LAST elements.
+ * \param[in]   node_histogram_table: Optional per-node histograms, allocated by the caller with (UNA_NODE_ADDRESS_LAST * UNA_TRACE_STAGE_LAST) elements.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_TRACE_status_t UNA_TRACE_init(UNA_TRACE_get_timestamp_cb_t get_timestamp, UNA_trace_histogram_t* histogram_table, UNA_trace_histogram_t* node_histogram_table);
+
+/*!******************************************************************
+ * \fn void UNA_TRACE_reset(void)
+ * \brief Clear all histograms.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_TRACE_reset(void);
+
+/*!******************************************************************
+ * \fn uint32_t UNA_TRACE_get_timestamp(void)
+ * \brief Read the current timestamp.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Current timestamp in ticks, 0 if tracing is not initialized.
+ *******************************************************************/
+uint32_t UNA_TRACE_get_timestamp(void);
+
+/*!******************************************************************
+ * \fn void UNA_TRACE_record(UNA_trace_stage_t stage, UNA_node_address_t node_addr, uint32_t start_timestamp)
+ * \brief Record the duration of a stage, from the given timestamp to now. Must be called from a single context.
+ * \param[in]   stage: Access stage.
+ * \param[in]   node_addr: Accessed node address.
+ * \param[in]   start_timestamp: Timestamp of the stage start.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void UNA_TRACE_record(UNA_trace_stage_t stage, UNA_node_address_t node_addr, uint32_t start_timestamp);
+
+/*!******************************************************************
+ * \fn UNA_TRACE_status_t UNA_TRACE_get_summary(UNA_trace_stage_t stage, UNA_trace_summary_t* summary)
+ * \brief Compute the duration summary of a stage over all nodes. Percentiles are rounded up to the histogram bucket bound.
+ * \param[in]   stage: Access stage.
+ * \param[out]  summary: Pointer to the stage summary.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_TRACE_status_t UNA_TRACE_get_summary(UNA_trace_stage_t stage, UNA_trace_summary_t* summary);
+
+/*!******************************************************************
+ * \fn UNA_TRACE_status_t UNA_TRACE_get_node_summary(UNA_node_address_t node_addr, UNA_trace_stage_t stage, UNA_trace_summary_t* summary)
+ * \brief Compute the duration summary of a stage for a single node. Percentiles are rounded up to the histogram bucket bound.
+ * \param[in]   node_addr: Node address.
+ * \param[in]   stage: Access stage.
+ * \param[out]  summary: Pointer to the stage summary.
+ * \retval      Function execution status.
+ *******************************************************************/
+UNA_TRACE_status_t UNA_TRACE_get_node_summary(UNA_node_address_t node_addr, UNA_trace_stage_t stage, UNA_trace_summary_t* summary);
+
+#endif /* UNA_LIB_USE_TRACE */
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_TRACE_H__ */
@@ -60,8 +60,92 @@
 
 #define UNA_YEAR_OFFSET                         2000
 
+#ifdef UNA_LIB_USE_FLOAT
+#define UNA_MV_PER_V                            1000
+#define UNA_UA_PER_A                            1000000
+#define UNA_MW_MVA_PER_W_VA                     1000
+#define UNA_MWH_MVAH_PER_WH_VAH                 1000
+#endif
+
+#define UNA_FIELD_MASK(size_bits)               ((0b1UL << (size_bits)) - 1)
+
+#ifdef UNA_LIB_USE_DECODE_TABLES
+#define UNA_TABLE_4(entry, n)                   entry(n), entry((n) + 1), entry((n) + 2), entry((n) + 3)
+#define UNA_TABLE_16(entry, n)                  UNA_TABLE_4(entry, n), UNA_TABLE_4(entry, (n) + 4), UNA_TABLE_4(entry, (n) + 8), UNA_TABLE_4(entry, (n) + 12)
+#define UNA_TABLE_64(entry, n)                  UNA_TABLE_16(entry, n), UNA_TABLE_16(entry, (n) + 16), UNA_TABLE_16(entry, (n) + 32), UNA_TABLE_16(entry, (n) + 48)
+#define UNA_TABLE_256(entry, n)                 UNA_TABLE_64(entry, n), UNA_TABLE_64(entry, (n) + 64), UNA_TABLE_64(entry, (n) + 128), UNA_TABLE_64(entry, (n) + 192)
+#define UNA_TABLE_1024(entry, n)                UNA_TABLE_256(entry, n), UNA_TABLE_256(entry, (n) + 256), UNA_TABLE_256(entry, (n) + 512), UNA_TABLE_256(entry, (n) + 768)
+#define UNA_TABLE_4096(entry, n)                UNA_TABLE_1024(entry, n), UNA_TABLE_1024(entry, (n) + 1024), UNA_TABLE_1024(entry, (n) + 2048), UNA_TABLE_1024(entry, (n) + 3072)
+
+#define UNA_TIME_TABLE_SIZE                     (0b1 << (UNA_TIME_UNIT_SIZE_BITS + UNA_TIME_VALUE_SIZE_BITS))
+#define UNA_TEMPERATURE_TABLE_SIZE              (0b1 << (UNA_SIGN_SIZE_BITS + UNA_TEMPERATURE_VALUE_SIZE_BITS))
+#define UNA_POWER_FACTOR_TABLE_SIZE             (0b1 << (UNA_SIGN_SIZE_BITS + UNA_POWER_FACTOR_VALUE_SIZE_BITS))
+
+#define UNA_TIME_TABLE_ENTRY(una_time) \
+    ((int32_t) (((una_time) & UNA_FIELD_MASK(UNA_TIME_VALUE_SIZE_BITS)) * \
+    ((((una_time) >> UNA_TIME_VALUE_SIZE_BITS) == UNA_TIME_UNIT_SECOND) ? 1 : \
+    ((((una_time) >> UNA_TIME_VALUE_SIZE_BITS) == UNA_TIME_UNIT_MINUTE) ? UNA_SECONDS_PER_MINUTE : \
+    ((((una_time) >> UNA_TIME_VALUE_SIZE_BITS) == UNA_TIME_UNIT_HOUR) ? (UNA_MINUTES_PER_HOUR * UNA_SECONDS_PER_MINUTE) : \
+    (UNA_HOURS_PER_DAY * UNA_MINUTES_PER_HOUR * UNA_SECONDS_PER_MINUTE))))))
+
+#define UNA_SIGNED_MAGNITUDE_TABLE_ENTRY(una_representation, value_size_bits) \
+    ((((una_representation) >> (value_size_bits)) == UNA_SIGN_POSITIVE) ? \
+    ((int32_t) ((una_representation) & UNA_FIELD_MASK(value_size_bits))) : \
+    ((-1) * ((int32_t) ((una_representation) & UNA_FIELD_MASK(value_size_bits)))))
+
+#define UNA_TEMPERATURE_TABLE_ENTRY(una_temperature)    UNA_SIGNED_MAGNITUDE_TABLE_ENTRY(una_temperature, UNA_TEMPERATURE_VALUE_SIZE_BITS)
+#define UNA_POWER_FACTOR_TABLE_ENTRY(una_power_factor)  UNA_SIGNED_MAGNITUDE_TABLE_ENTRY(una_power_factor, UNA_POWER_FACTOR_VALUE_SIZE_BITS)
+#endif
+
+#define UNA_ADDRESS_BOARD_TABLE_SIZE            (0b1 << 7)
+
+// Range designators are a GNU extension (GCC and Clang), reported by -Wpedantic.
+#define UNA_ADDRESS_BOARD_SINGLE(board)         [UNA_NODE_ADDRESS_##board] = { UNA_BOARD_ID_##board, UNA_NODE_ADDRESS_##board }
+#define UNA_ADDRESS_BOARD_RANGE(board)          [UNA_NODE_ADDRESS_##board##_START ... UNA_NODE_ADDRESS_##board##_END] = { UNA_BOARD_ID_##board, UNA_NODE_ADDRESS_##board##_START }
+#define UNA_ADDRESS_BOARD_NONE(first, last)     [(first) ... (last)] = { UNA_BOARD_ID_ERROR, UNA_NODE_ADDRESS_ERROR }
+
+#ifdef UNA_LIB_USE_BOARD_NAME
+// Boards name spelled as characters, so that the name strings and their hash table are generated from the same list.
+#define UNA_BOARD_NAME_LIST(X) \
+    X(LVRM, 'L', 'V', 'R', 'M') \
+    X(BPSM, 'B', 'P', 'S', 'M') \
+    X(DDRM, 'D', 'D', 'R', 'M') \
+    X(UHFM, 'U', 'H', 'F', 'M') \
+    X(GPSM, 'G', 'P', 'S', 'M') \
+    X(SM, 'S', 'M') \
+    X(RS485_BRIDGE, 'R', 'S', '4', '8', '5', '-', 'B', 'R', 'I', 'D', 'G', 'E') \
+    X(RRM, 'R', 'R', 'M') \
+    X(DMM, 'D', 'M', 'M') \
+    X(MPMCM, 'M', 'P', 'M', 'C', 'M') \
+    X(R4S8CR, 'R', '4', 'S', '8', 'C', 'R') \
+    X(BCM, 'B', 'C', 'M')
+
+#define UNA_BOARD_NAME_HASH_SIZE_BITS           5
+// Perfect hash of the boards name, from their two first characters.
+#define UNA_BOARD_NAME_HASH(first_char, second_char) \
+    (((((uint32_t) (uint8_t) (first_char)) << 1) + ((uint32_t) (uint8_t) (second_char))) & UNA_FIELD_MASK(UNA_BOARD_NAME_HASH_SIZE_BITS))
+#define UNA_BOARD_NAME_HASH_CHARS(first_char, second_char, ...) UNA_BOARD_NAME_HASH(first_char, second_char)
+
+#define UNA_BOARD_NAME_STRING(board, ...)       [UNA_BOARD_ID_##board] = (const char_t[]) { __VA_ARGS__, '\0' },
+#define UNA_BOARD_NAME_HASH_ENTRY(board, ...)   [UNA_BOARD_NAME_HASH_CHARS(__VA_ARGS__, '\0')] = UNA_BOARD_ID_##board,
+#define UNA_BOARD_NAME_HASH_BIT(board, ...)     | (0b1UL << UNA_BOARD_NAME_HASH_CHARS(__VA_ARGS__, '\0'))
+#define UNA_BOARD_NAME_COUNT(board, ...)        + 1
+#endif
+
+#ifdef UNA_LIB_USE_DIVISION_FREE
+#define UNA_RECIPROCAL_ENABLE                   1
+#else
+#define UNA_RECIPROCAL_ENABLE                   0
+#endif
+
 /*** UNA local structures ***/
 
+/*******************************************************************/
+typedef struct {
+    uint8_t board_id;
+    uint8_t first_address;
+} UNA_address_board_t;
+
 /*******************************************************************/
 typedef enum {
     UNA_SIGN_POSITIVE = 0,
@@ -76,45 +160,6 @@ typedef enum {
     UNA_TIME_UNIT_DAY
 } UNA_time_unit_t;
 
-/*******************************************************************/
-typedef enum {
-    UNA_VOLTAGE_UNIT_MV = 0,
-    UNA_VOLTAGE_UNIT_DV
-} UNA_voltage_unit_t;
-
-/*******************************************************************/
-typedef enum {
-    UNA_CURRENT_UNIT_UA = 0,
-    UNA_CURRENT_UNIT_DMA,
-    UNA_CURRENT_UNIT_MA,
-    UNA_CURRENT_UNIT_DA
-} UNA_current_unit_t;
-
-/*******************************************************************/
-typedef enum {
-    UNA_ELECTRICAL_POWER_UNIT_MW_MVA = 0,
-    UNA_ELECTRICAL_POWER_UNIT_DW_DVA,
-    UNA_ELECTRICAL_POWER_UNIT_W_VA,
-    UNA_ELECTRICAL_POWER_UNIT_DAW_DAVA
-} UNA_electrical_power_unit_t;
-
-/*******************************************************************/
-typedef enum {
-    UNA_ELECTRICAL_ENERGY_UNIT_MWH_MVAH = 0,
-    UNA_ELECTRICAL_ENERGY_UNIT_DWH_DVAH,
-    UNA_ELECTRICAL_ENERGY_UNIT_WH_VAH,
-    UNA_ELECTRICAL_ENERGY_UNIT_DAWH_DAVAH
-} UNA_electrical_energy_unit_t;
-
-/*******************************************************************/
-typedef union {
-    uint32_t representation;
-    struct {
-        unsigned value : UNA_TIME_VALUE_SIZE_BITS;
-        UNA_time_unit_t unit : UNA_TIME_UNIT_SIZE_BITS;
-    } __attribute__((scalar_storage_order("little-endian"))) __attribute__((packed));
-} UNA_time_t;
-
 /*******************************************************************/
 typedef union {
     uint32_t representation;
@@ -128,55 +173,184 @@ typedef union {
 typedef union {
     uint32_t representation;
     struct {
-        unsigned value : UNA_VOLTAGE_VALUE_SIZE_BITS;
-        UNA_voltage_unit_t unit : UNA_VOLTAGE_UNIT_SIZE_BITS;
+        unsigned value : UNA_POWER_FACTOR_VALUE_SIZE_BITS;
+        UNA_sign_t sign : UNA_SIGN_SIZE_BITS;
     } __attribute__((scalar_storage_order("little-endian"))) __attribute__((packed));
-} UNA_voltage_t;
+} UNA_power_factor_t;
+
+/*** UNA local global variables ***/
+
+#ifdef UNA_LIB_USE_FLOAT
+// Unit multipliers fused with the conversion to SI units.
+static const float64_t UNA_VOLTAGE_UNIT_SCALE[0b1 << UNA_VOLTAGE_UNIT_SIZE_BITS] = {
+    (1.0 / UNA_MV_PER_V),
+    ((float64_t) UNA_MV_PER_DV / UNA_MV_PER_V)
+};
+
+static const float64_t UNA_CURRENT_UNIT_SCALE[0b1 << UNA_CURRENT_UNIT_SIZE_BITS] = {
+    (1.0 / UNA_UA_PER_A),
+    ((float64_t) UNA_UA_PER_DMA / UNA_UA_PER_A),
+    ((float64_t) (UNA_UA_PER_DMA * UNA_DMA_PER_MA) / UNA_UA_PER_A),
+    ((float64_t) (UNA_UA_PER_DMA * UNA_DMA_PER_MA * UNA_MA_PER_DA) / UNA_UA_PER_A)
+};
+
+static const float64_t UNA_ELECTRICAL_POWER_UNIT_SCALE[0b1 << UNA_ELECTRICAL_POWER_UNIT_SIZE_BITS] = {
+    (1.0 / UNA_MW_MVA_PER_W_VA),
+    ((float64_t) UNA_MW_MVA_PER_DW_DVA / UNA_MW_MVA_PER_W_VA),
+    ((float64_t) (UNA_MW_MVA_PER_DW_DVA * UNA_DW_DVA_PER_W_VA) / UNA_MW_MVA_PER_W_VA),
+    ((float64_t) (UNA_MW_MVA_PER_DW_DVA * UNA_DW_DVA_PER_W_VA * UNA_W_VA_PER_DAW_DAVA) / UNA_MW_MVA_PER_W_VA)
+};
+
+static const float64_t UNA_ELECTRICAL_ENERGY_UNIT_SCALE[0b1 << UNA_ELECTRICAL_ENERGY_UNIT_SIZE_BITS] = {
+    (1.0 / UNA_MWH_MVAH_PER_WH_VAH),
+    ((float64_t) UNA_MWH_MVAH_PER_DWH_DVAH / UNA_MWH_MVAH_PER_WH_VAH),
+    ((float64_t) (UNA_MWH_MVAH_PER_DWH_DVAH * UNA_DWH_DVAH_PER_WH_VAH) / UNA_MWH_MVAH_PER_WH_VAH),
+    ((float64_t) (UNA_MWH_MVAH_PER_DWH_DVAH * UNA_DWH_DVAH_PER_WH_VAH * UNA_WH_VAH_PER_DAWH_DAVAH) / UNA_MWH_MVAH_PER_WH_VAH)
+};
+
+#endif
+#ifdef UNA_LIB_USE_DECODE_TABLES
+// Full decoding tables, generated by the preprocessor and stored in flash memory.
+static const int32_t UNA_TIME_TABLE[UNA_TIME_TABLE_SIZE] = { UNA_TABLE_256(UNA_TIME_TABLE_ENTRY, 0) };
+static const int16_t UNA_TEMPERATURE_TABLE[UNA_TEMPERATURE_TABLE_SIZE] = { UNA_TABLE_4096(UNA_TEMPERATURE_TABLE_ENTRY, 0) };
+static const int8_t UNA_POWER_FACTOR_TABLE[UNA_POWER_FACTOR_TABLE_SIZE] = { UNA_TABLE_256(UNA_POWER_FACTOR_TABLE_ENTRY, 0) };
+#endif
+
+// Board of each 7-bits node address, generated from the addresses enumeration.
+static const UNA_address_board_t UNA_ADDRESS_BOARD[UNA_ADDRESS_BOARD_TABLE_SIZE] = {
+    UNA_ADDRESS_BOARD_NONE(UNA_NODE_ADDRESS_MASTER, UNA_NODE_ADDRESS_MASTER),
+    UNA_ADDRESS_BOARD_SINGLE(RS485_BRIDGE),
+    UNA_ADDRESS_BOARD_SINGLE(BPSM),
+    UNA_ADDRESS_BOARD_SINGLE(UHFM),
+    UNA_ADDRESS_BOARD_SINGLE(GPSM),
+    UNA_ADDRESS_BOARD_SINGLE(SM),
+    UNA_ADDRESS_BOARD_SINGLE(MPMCM),
+    UNA_ADDRESS_BOARD_SINGLE(BCM),
+    UNA_ADDRESS_BOARD_NONE((UNA_NODE_ADDRESS_BCM + 1), (UNA_NODE_ADDRESS_LVRM_START - 1)),
+    UNA_ADDRESS_BOARD_RANGE(LVRM),
+    UNA_ADDRESS_BOARD_RANGE(DDRM),
+    UNA_ADDRESS_BOARD_RANGE(RRM),
+    UNA_ADDRESS_BOARD_NONE((UNA_NODE_ADDRESS_RRM_END + 1), (UNA_NODE_ADDRESS_R4S8CR_START - 1)),
+    UNA_ADDRESS_BOARD_RANGE(R4S8CR),
+    UNA_ADDRESS_BOARD_NONE(UNA_NODE_ADDRESS_LAST, (UNA_ADDRESS_BOARD_TABLE_SIZE - 1))
+};
+
+#ifdef UNA_LIB_USE_BOARD_NAME
+// Unused slots point to the first board, the candidate name is always compared.
+static const uint8_t UNA_BOARD_NAME_HASH_TABLE[0b1 << UNA_BOARD_NAME_HASH_SIZE_BITS] = {
+    UNA_BOARD_NAME_LIST(UNA_BOARD_NAME_HASH_ENTRY)
+};
+
+// All boards are named, and each name hashes to its own slot.
+_Static_assert((0 UNA_BOARD_NAME_LIST(UNA_BOARD_NAME_COUNT)) == UNA_BOARD_ID_LAST, "UNA board name missing");
+_Static_assert(__builtin_popcountl(0 UNA_BOARD_NAME_LIST(UNA_BOARD_NAME_HASH_BIT)) == UNA_BOARD_ID_LAST, "UNA board name hash collision");
+#endif
+
+/*** UNA global variables ***/
+
+const UNA_floating_unit_t UNA_FLOATING_UNIT_TIME = UNA_FLOATING_UNIT(UNA_TIME_VALUE_SIZE_BITS, UNA_TIME_UNIT_SIZE_BITS, 0, UNA_SECONDS_PER_MINUTE, UNA_MINUTES_PER_HOUR, UNA_HOURS_PER_DAY);
+const UNA_floating_unit_t UNA_FLOATING_UNIT_VOLTAGE = UNA_FLOATING_UNIT(UNA_VOLTAGE_VALUE_SIZE_BITS, UNA_VOLTAGE_UNIT_SIZE_BITS, 0, UNA_MV_PER_DV, 1, 1);
+const UNA_floating_unit_t UNA_FLOATING_UNIT_CURRENT = UNA_FLOATING_UNIT(UNA_CURRENT_VALUE_SIZE_BITS, UNA_CURRENT_UNIT_SIZE_BITS, 0, UNA_UA_PER_DMA, UNA_DMA_PER_MA, UNA_MA_PER_DA);
+const UNA_floating_unit_t UNA_FLOATING_UNIT_ELECTRICAL_POWER = UNA_FLOATING_UNIT(UNA_ELECTRICAL_POWER_VALUE_SIZE_BITS, UNA_ELECTRICAL_POWER_UNIT_SIZE_BITS, UNA_SIGN_SIZE_BITS, UNA_MW_MVA_PER_DW_DVA, UNA_DW_DVA_PER_W_VA, UNA_W_VA_PER_DAW_DAVA);
+const UNA_floating_unit_t UNA_FLOATING_UNIT_ELECTRICAL_ENERGY = UNA_FLOATING_UNIT(UNA_ELECTRICAL_ENERGY_VALUE_SIZE_BITS, UNA_ELECTRICAL_ENERGY_UNIT_SIZE_BITS, UNA_SIGN_SIZE_BITS, UNA_MWH_MVAH_PER_DWH_DVAH, UNA_DWH_DVAH_PER_WH_VAH, UNA_WH_VAH_PER_DAWH_DAVAH);
+
+#ifdef UNA_LIB_USE_BOARD_NAME
+const char_t* const UNA_BOARD_NAME[UNA_BOARD_ID_LAST] = {
+    UNA_BOARD_NAME_LIST(UNA_BOARD_NAME_STRING)
+};
+#endif
+
+/*** UNA local functions ***/
 
 /*******************************************************************/
-typedef union {
-    uint32_t representation;
-    struct {
-        unsigned value : UNA_CURRENT_VALUE_SIZE_BITS;
-        UNA_current_unit_t unit : UNA_CURRENT_UNIT_SIZE_BITS;
-    } __attribute__((scalar_storage_order("little-endian"))) __attribute__((packed));
-} UNA_current_t;
+static inline int32_t _UNA_decode_floating_unit(uint32_t una_representation, const UNA_floating_unit_t* floating_unit) {
+    // Extract fields with shifts and masks only, so that the loop calling this function has no data-dependent branch.
+    uint32_t value = (una_representation & UNA_FIELD_MASK(floating_unit->value_size_bits));
+    uint32_t unit = ((una_representation >> floating_unit->value_size_bits) & UNA_FIELD_MASK(floating_unit->unit_size_bits));
+    int32_t sign = (int32_t) ((una_representation >> (floating_unit->value_size_bits + floating_unit->unit_size_bits)) & UNA_FIELD_MASK(floating_unit->sign_size_bits));
+    // Apply sign without branch.
+    return ((1 - (sign << 1)) * floating_unit->unit_multiplier[unit] * ((int32_t) value));
+}
 
 /*******************************************************************/
-typedef union {
-    uint32_t representation;
-    struct {
-        unsigned value : UNA_ELECTRICAL_POWER_VALUE_SIZE_BITS;
-        UNA_electrical_power_unit_t unit : UNA_ELECTRICAL_POWER_UNIT_SIZE_BITS;
-        UNA_sign_t sign : UNA_SIGN_SIZE_BITS;
-    } __attribute__((scalar_storage_order("little-endian"))) __attribute__((packed));
-} UNA_electrical_power_t;
+static inline int32_t _UNA_decode_signed_magnitude(uint32_t una_representation, uint8_t value_size_bits) {
+    // Local variables.
+    int32_t absolute_value = (int32_t) (una_representation & UNA_FIELD_MASK(value_size_bits));
+    int32_t sign = (int32_t) ((una_representation >> value_size_bits) & UNA_FIELD_MASK(UNA_SIGN_SIZE_BITS));
+    // Apply sign without branch.
+    return ((1 - (sign << 1)) * absolute_value);
+}
 
 /*******************************************************************/
-typedef union {
-    uint32_t representation;
-    struct {
-        unsigned value : UNA_ELECTRICAL_ENERGY_VALUE_SIZE_BITS;
-        UNA_electrical_energy_unit_t unit : UNA_ELECTRICAL_ENERGY_UNIT_SIZE_BITS;
-        UNA_sign_t sign : UNA_SIGN_SIZE_BITS;
-    } __attribute__((scalar_storage_order("little-endian"))) __attribute__((packed));
-} UNA_electrical_energy_t;
+static inline int32_t _UNA_decode_time(uint32_t una_time) {
+#ifdef UNA_LIB_USE_DECODE_TABLES
+    return UNA_TIME_TABLE[una_time & UNA_FIELD_MASK(UNA_TIME_UNIT_SIZE_BITS + UNA_TIME_VALUE_SIZE_BITS)];
+#else
+    return _UNA_decode_floating_unit(una_time, &UNA_FLOATING_UNIT_TIME);
+#endif
+}
 
 /*******************************************************************/
-typedef union {
-    uint32_t representation;
-    struct {
-        unsigned value : UNA_POWER_FACTOR_VALUE_SIZE_BITS;
-        UNA_sign_t sign : UNA_SIGN_SIZE_BITS;
-    } __attribute__((scalar_storage_order("little-endian"))) __attribute__((packed));
-} UNA_power_factor_t;
+static inline int32_t _UNA_decode_temperature(uint32_t una_temperature) {
+#ifdef UNA_LIB_USE_DECODE_TABLES
+    return ((int32_t) UNA_TEMPERATURE_TABLE[una_temperature & UNA_FIELD_MASK(UNA_SIGN_SIZE_BITS + UNA_TEMPERATURE_VALUE_SIZE_BITS)]);
+#else
+    return _UNA_decode_signed_magnitude(una_temperature, UNA_TEMPERATURE_VALUE_SIZE_BITS);
+#endif
+}
 
-/*** UNA global variables ***/
+/*******************************************************************/
+static inline int32_t _UNA_decode_power_factor(uint32_t una_power_factor) {
+#ifdef UNA_LIB_USE_DECODE_TABLES
+    return ((int32_t) UNA_POWER_FACTOR_TABLE[una_power_factor & UNA_FIELD_MASK(UNA_SIGN_SIZE_BITS + UNA_POWER_FACTOR_VALUE_SIZE_BITS)]);
+#else
+    return _UNA_decode_signed_magnitude(una_power_factor, UNA_POWER_FACTOR_VALUE_SIZE_BITS);
+#endif
+}
 
-#ifdef UNA_LIB_USE_BOARD_NAME
-const char_t* const UNA_BOARD_NAME[UNA_BOARD_ID_LAST] = { "LVRM", "BPSM", "DDRM", "UHFM", "GPSM", "SM", "RS485-BRIDGE", "RRM", "DMM", "MPMCM", "R4S8CR", "BCM" };
+#ifdef UNA_LIB_USE_FLOAT
+/*******************************************************************/
+static inline float64_t _UNA_decode_floating_unit_si(uint32_t una_representation, const UNA_floating_unit_t* floating_unit, const float64_t* unit_scale) {
+    // Single multiplication by the fused scale factor, without intermediate integer which could overflow.
+    uint32_t value = (una_representation & UNA_FIELD_MASK(floating_unit->value_size_bits));
+    uint32_t unit = ((una_representation >> floating_unit->value_size_bits) & UNA_FIELD_MASK(floating_unit->unit_size_bits));
+    int32_t sign = (int32_t) ((una_representation >> (floating_unit->value_size_bits + floating_unit->unit_size_bits)) & UNA_FIELD_MASK(floating_unit->sign_size_bits));
+    // Apply sign without branch.
+    return (((float64_t) (1 - (sign << 1))) * unit_scale[unit] * ((float64_t) value));
+}
 #endif
 
+/*******************************************************************/
+static inline uint32_t _UNA_encode_floating_unit(int32_t physical_data, const UNA_floating_unit_t* floating_unit, uint8_t reciprocal_enable) {
+    // Local variables.
+    uint32_t absolute_value = 0;
+    uint32_t sign = (((uint32_t) physical_data) >> (MATH_U32_SIZE_BITS - 1));
+    uint32_t unit = 0;
+    uint32_t idx = 0;
+    uint32_t value = 0;
+    // Read absolute value.
+    MATH_abs(physical_data, absolute_value, uint32_t);
+    // Count reached thresholds without branch.
+    for (idx = 0; idx < floating_unit->last_unit; idx++) {
+        unit += (absolute_value >= floating_unit->threshold[idx]) ? 1 : 0;
+    }
+    // Divide by the unit ratio, with a multiplication by its reciprocal on cores without hardware divider.
+    if (reciprocal_enable != 0) {
+        value = (uint32_t) ((((uint64_t) absolute_value) * floating_unit->reciprocal[unit].multiplier) >> floating_unit->reciprocal[unit].shift);
+    }
+    else {
+        value = (absolute_value / ((uint32_t) floating_unit->unit_multiplier[unit]));
+    }
+    // Sign is dropped for unsigned quantities.
+    return ((value & UNA_FIELD_MASK(floating_unit->value_size_bits)) | (unit << floating_unit->value_size_bits) | ((sign & UNA_FIELD_MASK(floating_unit->sign_size_bits)) << (floating_unit->value_size_bits + floating_unit->unit_size_bits)));
+}
+
+/*******************************************************************/
+static inline uint32_t _UNA_encode_voltage(int32_t voltage_mv, uint8_t reciprocal_enable) {
+    // Unit is selected from the signed input, so that negative values are truncated in the mV unit.
+    return _UNA_encode_floating_unit(((voltage_mv < 0) ? ((int32_t) ((0 - (uint32_t) voltage_mv) & UNA_FIELD_MASK(UNA_VOLTAGE_VALUE_SIZE_BITS))) : voltage_mv), &UNA_FLOATING_UNIT_VOLTAGE, reciprocal_enable);
+}
+
 /*** UNA functions ***/
 
 /*******************************************************************/
@@ -193,63 +367,124 @@ void UNA_reset_node_list(UNA_node_list_t* node_list) {
     }
 }
 
+/*******************************************************************/
+UNA_board_id_t UNA_get_board_id(UNA_node_address_t node_addr, uint8_t* node_index) {
+    // Local variables.
+    UNA_board_id_t board_id = UNA_BOARD_ID_ERROR;
+    // Check address.
+    if (((uint32_t) node_addr) >= UNA_ADDRESS_BOARD_TABLE_SIZE) {
+        goto errors;
+    }
+    board_id = (UNA_board_id_t) UNA_ADDRESS_BOARD[node_addr].board_id;
+    if ((node_index != NULL) && (board_id != UNA_BOARD_ID_ERROR)) {
+        (*node_index) = (uint8_t) (node_addr - UNA_ADDRESS_BOARD[node_addr].first_address);
+    }
+errors:
+    return board_id;
+}
+
+#ifdef UNA_LIB_USE_BOARD_NAME
+/*******************************************************************/
+UNA_board_id_t UNA_get_board_id_from_name(const char_t* board_name) {
+    // Local variables.
+    UNA_board_id_t board_id = UNA_BOARD_ID_ERROR;
+    const char_t* candidate_name = NULL;
+    uint8_t idx = 0;
+    // Check parameter.
+    if ((board_name == NULL) || (board_name[0] == '\0')) {
+        goto errors;
+    }
+    candidate_name = UNA_BOARD_NAME[UNA_BOARD_NAME_HASH_TABLE[UNA_BOARD_NAME_HASH(board_name[0], board_name[1])]];
+    // Single comparison with the candidate name.
+    while ((board_name[idx] != '\0') && (board_name[idx] == candidate_name[idx])) {
+        idx++;
+    }
+    if (board_name[idx] == candidate_name[idx]) {
+        board_id = (UNA_board_id_t) UNA_BOARD_NAME_HASH_TABLE[UNA_BOARD_NAME_HASH(board_name[0], board_name[1])];
+    }
+errors:
+    return board_id;
+}
+#endif
+
+/*******************************************************************/
+uint32_t UNA_convert_floating_unit(const UNA_floating_unit_t* floating_unit, int32_t physical_data) {
+    // Check parameter.
+    if (floating_unit == NULL) {
+        return 0;
+    }
+    return _UNA_encode_floating_unit(physical_data, floating_unit, UNA_RECIPROCAL_ENABLE);
+}
+
+/*******************************************************************/
+void UNA_convert_floating_unit_batch(const UNA_floating_unit_t* floating_unit, const int32_t* physical_data, uint32_t* una_representation, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((floating_unit == NULL) || (physical_data == NULL) || (una_representation == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        una_representation[idx] = _UNA_encode_floating_unit(physical_data[idx], floating_unit, 1);
+    }
+}
+
+/*******************************************************************/
+int32_t UNA_get_floating_unit(const UNA_floating_unit_t* floating_unit, uint32_t una_representation) {
+    // Check parameter.
+    if (floating_unit == NULL) {
+        return 0;
+    }
+    return _UNA_decode_floating_unit(una_representation, floating_unit);
+}
+
+/*******************************************************************/
+void UNA_get_floating_unit_batch(const UNA_floating_unit_t* floating_unit, const uint32_t* una_representation, int32_t* physical_data, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((floating_unit == NULL) || (una_representation == NULL) || (physical_data == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        physical_data[idx] = _UNA_decode_floating_unit(una_representation[idx], floating_unit);
+    }
+}
+
 /*******************************************************************/
 uint32_t UNA_convert_seconds(int32_t time_seconds) {
+    return _UNA_encode_floating_unit(time_seconds, &UNA_FLOATING_UNIT_TIME, UNA_RECIPROCAL_ENABLE);
+}
+
+/*******************************************************************/
+void UNA_convert_seconds_batch(const int32_t* time_seconds, uint32_t* una_time, uint32_t size) {
     // Local variables.
-    UNA_time_t una_time;
-    uint32_t value = 0;
-    // Negative values not supported.
-    MATH_abs(time_seconds, value, uint32_t);
-    // Select unit.
-    if (value < (0b1 << UNA_TIME_VALUE_SIZE_BITS)) {
-        una_time.unit = UNA_TIME_UNIT_SECOND;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((time_seconds == NULL) || (una_time == NULL)) {
+        return;
     }
-    else {
-        value /= UNA_SECONDS_PER_MINUTE;
-        if (value < (0b1 << UNA_TIME_VALUE_SIZE_BITS)) {
-            una_time.unit = UNA_TIME_UNIT_MINUTE;
-        }
-        else {
-            value /= UNA_MINUTES_PER_HOUR;
-            if (value < (0b1 << UNA_TIME_VALUE_SIZE_BITS)) {
-                una_time.unit = UNA_TIME_UNIT_HOUR;
-            }
-            else {
-                value /= UNA_HOURS_PER_DAY;
-                una_time.unit = UNA_TIME_UNIT_DAY;
-            }
-        }
+    for (idx = 0; idx < size; idx++) {
+        una_time[idx] = _UNA_encode_floating_unit(time_seconds[idx], &UNA_FLOATING_UNIT_TIME, 1);
     }
-    una_time.value = value;
-    return (una_time.representation);
 }
 
 /*******************************************************************/
 int32_t UNA_get_seconds(uint32_t una_time) {
+    return _UNA_decode_time(una_time);
+}
+
+/*******************************************************************/
+void UNA_get_seconds_batch(const uint32_t* una_time, int32_t* time_seconds, uint32_t size) {
     // Local variables.
-    int32_t time_seconds = 0;
-    uint32_t local_una_time = una_time;
-    uint32_t value = 0;
-    UNA_time_unit_t unit = UNA_TIME_UNIT_SECOND;
-    // Parse fields.
-    unit = (((UNA_time_t*) &local_una_time)->unit);
-    value = (uint32_t) (((UNA_time_t*) &local_una_time)->value);
-    // Compute seconds.
-    switch (unit) {
-    case UNA_TIME_UNIT_SECOND:
-        time_seconds = (int32_t) value;
-        break;
-    case UNA_TIME_UNIT_MINUTE:
-        time_seconds = (int32_t) (UNA_SECONDS_PER_MINUTE * value);
-        break;
-    case UNA_TIME_UNIT_HOUR:
-        time_seconds = (int32_t) (UNA_MINUTES_PER_HOUR * UNA_SECONDS_PER_MINUTE * value);
-        break;
-    default:
-        time_seconds = (int32_t) (UNA_HOURS_PER_DAY * UNA_MINUTES_PER_HOUR * UNA_SECONDS_PER_MINUTE * value);
-        break;
-    }
-    return time_seconds;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_time == NULL) || (time_seconds == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        time_seconds[idx] = _UNA_decode_time(una_time[idx]);
+    }
 }
 
 /*******************************************************************/
@@ -262,6 +497,19 @@ int32_t UNA_get_year(uint32_t una_year) {
     return ((int32_t) (una_year + UNA_YEAR_OFFSET));
 }
 
+/*******************************************************************/
+void UNA_get_year_batch(const uint32_t* una_year, int32_t* year, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_year == NULL) || (year == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        year[idx] = ((int32_t) (una_year[idx] + UNA_YEAR_OFFSET));
+    }
+}
+
 /*******************************************************************/
 uint32_t UNA_convert_tenth_degrees(int32_t temperature_tenth_degrees) {
     // Local variables.
@@ -273,6 +521,9 @@ uint32_t UNA_convert_tenth_degrees(int32_t temperature_tenth_degrees) {
 
 /*******************************************************************/
 int32_t UNA_get_tenth_degrees(uint32_t una_temperature) {
+#ifdef UNA_LIB_USE_DECODE_TABLES
+    return _UNA_decode_temperature(una_temperature);
+#else
     // Local variables.
     int32_t temperature_tenth_degrees = 0;
     uint32_t local_una_temperature = una_temperature;
@@ -284,231 +535,164 @@ int32_t UNA_get_tenth_degrees(uint32_t una_temperature) {
     // Check sign.
     temperature_tenth_degrees = (sign == UNA_SIGN_POSITIVE) ? ((int32_t) value) : ((-1) * ((int32_t) value));
     return temperature_tenth_degrees;
+#endif
+}
+
+/*******************************************************************/
+void UNA_get_tenth_degrees_batch(const uint32_t* una_temperature, int32_t* temperature_tenth_degrees, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_temperature == NULL) || (temperature_tenth_degrees == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        temperature_tenth_degrees[idx] = _UNA_decode_temperature(una_temperature[idx]);
+    }
 }
 
 /*******************************************************************/
 uint32_t UNA_convert_mv(int32_t voltage_mv) {
+    return _UNA_encode_voltage(voltage_mv, UNA_RECIPROCAL_ENABLE);
+}
+
+/*******************************************************************/
+void UNA_convert_mv_batch(const int32_t* voltage_mv, uint32_t* una_voltage, uint32_t size) {
     // Local variables.
-    UNA_voltage_t una_voltage;
-    uint32_t value = 0;
-    // Negative values not supported.
-    MATH_abs(voltage_mv, value, uint32_t);
-    // Select format.
-    if (voltage_mv < (0b1 << UNA_VOLTAGE_VALUE_SIZE_BITS)) {
-        una_voltage.unit = UNA_VOLTAGE_UNIT_MV;
-        una_voltage.value = value;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((voltage_mv == NULL) || (una_voltage == NULL)) {
+        return;
     }
-    else {
-        una_voltage.unit = UNA_VOLTAGE_UNIT_DV;
-        una_voltage.value = (value / UNA_MV_PER_DV);
+    for (idx = 0; idx < size; idx++) {
+        una_voltage[idx] = _UNA_encode_voltage(voltage_mv[idx], 1);
     }
-    return (una_voltage.representation);
 }
 
 /*******************************************************************/
 int32_t UNA_get_mv(uint32_t una_voltage) {
+    return _UNA_decode_floating_unit(una_voltage, &UNA_FLOATING_UNIT_VOLTAGE);
+}
+
+/*******************************************************************/
+void UNA_get_mv_batch(const uint32_t* una_voltage, int32_t* voltage_mv, uint32_t size) {
     // Local variables.
-    int32_t voltage_mv = 0;
-    uint32_t local_una_voltage = una_voltage;
-    uint32_t value = 0;
-    UNA_voltage_unit_t unit = UNA_VOLTAGE_UNIT_MV;
-    // Parse fields.
-    unit = (((UNA_voltage_t*) &local_una_voltage)->unit);
-    value = (uint32_t) (((UNA_voltage_t*) &local_una_voltage)->value);
-    // Compute mV.
-    voltage_mv = (unit == UNA_VOLTAGE_UNIT_MV) ? ((int32_t) value) : ((UNA_MV_PER_DV * (int32_t) value));
-    return voltage_mv;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_voltage == NULL) || (voltage_mv == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        voltage_mv[idx] = _UNA_decode_floating_unit(una_voltage[idx], &UNA_FLOATING_UNIT_VOLTAGE);
+    }
 }
 
 /*******************************************************************/
 uint32_t UNA_convert_ua(int32_t current_ua) {
+    return _UNA_encode_floating_unit(current_ua, &UNA_FLOATING_UNIT_CURRENT, UNA_RECIPROCAL_ENABLE);
+}
+
+/*******************************************************************/
+void UNA_convert_ua_batch(const int32_t* current_ua, uint32_t* una_current, uint32_t size) {
     // Local variables.
-    UNA_current_t una_current;
-    uint32_t value = 0;
-    // Negative values not supported.
-    MATH_abs(current_ua, value, uint32_t);
-    // Select unit.
-    if (value < (0b1 << UNA_CURRENT_VALUE_SIZE_BITS)) {
-        una_current.unit = UNA_CURRENT_UNIT_UA;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((current_ua == NULL) || (una_current == NULL)) {
+        return;
     }
-    else {
-        value /= UNA_UA_PER_DMA;
-        if (value < (0b1 << UNA_CURRENT_VALUE_SIZE_BITS)) {
-            una_current.unit = UNA_CURRENT_UNIT_DMA;
-        }
-        else {
-            value /= UNA_DMA_PER_MA;
-            if (value < (0b1 << UNA_CURRENT_VALUE_SIZE_BITS)) {
-                una_current.unit = UNA_CURRENT_UNIT_MA;
-            }
-            else {
-                value /= UNA_MA_PER_DA;
-                una_current.unit = UNA_CURRENT_UNIT_DA;
-            }
-        }
+    for (idx = 0; idx < size; idx++) {
+        una_current[idx] = _UNA_encode_floating_unit(current_ua[idx], &UNA_FLOATING_UNIT_CURRENT, 1);
     }
-    una_current.value = value;
-    return (una_current.representation);
 }
 
 /*******************************************************************/
 int32_t UNA_get_ua(uint32_t una_current) {
+    return _UNA_decode_floating_unit(una_current, &UNA_FLOATING_UNIT_CURRENT);
+}
+
+/*******************************************************************/
+void UNA_get_ua_batch(const uint32_t* una_current, int32_t* current_ua, uint32_t size) {
     // Local variables.
-    int32_t current_ua = 0;
-    uint32_t local_una_current = una_current;
-    uint32_t value = 0;
-    UNA_current_unit_t unit = UNA_CURRENT_UNIT_UA;
-    // Parse fields.
-    unit = (((UNA_current_t*) &local_una_current)->unit);
-    value = (uint32_t) (((UNA_current_t*) &local_una_current)->value);
-    // Compute seconds.
-    switch (unit) {
-    case UNA_CURRENT_UNIT_UA:
-        current_ua = (int32_t) value;
-        break;
-    case UNA_CURRENT_UNIT_DMA:
-        current_ua = (int32_t) (UNA_UA_PER_DMA * value);
-        break;
-    case UNA_CURRENT_UNIT_MA:
-        current_ua = (int32_t) (UNA_UA_PER_DMA * UNA_DMA_PER_MA * value);
-        break;
-    default:
-        current_ua = (int32_t) (UNA_UA_PER_DMA * UNA_DMA_PER_MA * UNA_MA_PER_DA * value);
-        break;
-    }
-    return current_ua;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_current == NULL) || (current_ua == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        current_ua[idx] = _UNA_decode_floating_unit(una_current[idx], &UNA_FLOATING_UNIT_CURRENT);
+    }
 }
 
 /*******************************************************************/
 uint32_t UNA_convert_mw_mva(int32_t electrical_power_mw_mva) {
+    return _UNA_encode_floating_unit(electrical_power_mw_mva, &UNA_FLOATING_UNIT_ELECTRICAL_POWER, UNA_RECIPROCAL_ENABLE);
+}
+
+/*******************************************************************/
+void UNA_convert_mw_mva_batch(const int32_t* electrical_power_mw_mva, uint32_t* una_electrical_power, uint32_t size) {
     // Local variables.
-    UNA_electrical_power_t una_electrical_power;
-    uint32_t absolute_value = 0;
-    // Read absolute value.
-    MATH_abs(electrical_power_mw_mva, absolute_value, uint32_t);
-    // Select sign.
-    una_electrical_power.sign = (electrical_power_mw_mva < 0) ? UNA_SIGN_NEGATIVE : UNA_SIGN_POSITIVE;
-    // Select unit.
-    if (absolute_value < (0b1 << UNA_ELECTRICAL_POWER_VALUE_SIZE_BITS)) {
-        una_electrical_power.unit = UNA_ELECTRICAL_POWER_UNIT_MW_MVA;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((electrical_power_mw_mva == NULL) || (una_electrical_power == NULL)) {
+        return;
     }
-    else {
-        absolute_value /= UNA_MW_MVA_PER_DW_DVA;
-        if (absolute_value < (0b1 << UNA_ELECTRICAL_POWER_VALUE_SIZE_BITS)) {
-            una_electrical_power.unit = UNA_ELECTRICAL_POWER_UNIT_DW_DVA;
-        }
-        else {
-            absolute_value /= UNA_DW_DVA_PER_W_VA;
-            if (absolute_value < (0b1 << UNA_ELECTRICAL_POWER_VALUE_SIZE_BITS)) {
-                una_electrical_power.unit = UNA_ELECTRICAL_POWER_UNIT_W_VA;
-            }
-            else {
-                absolute_value /= UNA_W_VA_PER_DAW_DAVA;
-                una_electrical_power.unit = UNA_ELECTRICAL_POWER_UNIT_DAW_DAVA;
-            }
-        }
+    for (idx = 0; idx < size; idx++) {
+        una_electrical_power[idx] = _UNA_encode_floating_unit(electrical_power_mw_mva[idx], &UNA_FLOATING_UNIT_ELECTRICAL_POWER, 1);
     }
-    una_electrical_power.value = absolute_value;
-    return (una_electrical_power.representation);
 }
 
 /*******************************************************************/
 int32_t UNA_get_mw_mva(uint32_t una_electrical_power) {
+    return _UNA_decode_floating_unit(una_electrical_power, &UNA_FLOATING_UNIT_ELECTRICAL_POWER);
+}
+
+/*******************************************************************/
+void UNA_get_mw_mva_batch(const uint32_t* una_electrical_power, int32_t* electrical_power_mw_mva, uint32_t size) {
     // Local variables.
-    int32_t electrical_power_mw_mva = 0;
-    int32_t absolute_value = 0;
-    int32_t sign_multiplicator = 0;
-    uint32_t local_una_electrical_power = una_electrical_power;
-    UNA_electrical_power_unit_t unit = UNA_ELECTRICAL_POWER_UNIT_MW_MVA;
-    UNA_sign_t sign = UNA_SIGN_POSITIVE;
-    // Parse fields.
-    sign = ((UNA_electrical_power_t*) &local_una_electrical_power)->sign;
-    unit = ((UNA_electrical_power_t*) &local_una_electrical_power)->unit;
-    absolute_value = (int32_t) ((UNA_electrical_power_t*) &local_una_electrical_power)->value;
-    // Compute multiplicator.
-    sign_multiplicator = (sign == UNA_SIGN_NEGATIVE) ? (-1) : (1);
-    // Compute seconds.
-    switch (unit) {
-    case UNA_ELECTRICAL_POWER_UNIT_MW_MVA:
-        electrical_power_mw_mva = (absolute_value * sign_multiplicator);
-        break;
-    case UNA_ELECTRICAL_POWER_UNIT_DW_DVA:
-        electrical_power_mw_mva = (UNA_MW_MVA_PER_DW_DVA * absolute_value * sign_multiplicator);
-        break;
-    case UNA_ELECTRICAL_POWER_UNIT_W_VA:
-        electrical_power_mw_mva = (UNA_MW_MVA_PER_DW_DVA * UNA_DW_DVA_PER_W_VA * absolute_value * sign_multiplicator);
-        break;
-    default:
-        electrical_power_mw_mva = (UNA_MW_MVA_PER_DW_DVA * UNA_DW_DVA_PER_W_VA * UNA_W_VA_PER_DAW_DAVA * absolute_value * sign_multiplicator);
-        break;
-    }
-    return electrical_power_mw_mva;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_electrical_power == NULL) || (electrical_power_mw_mva == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        electrical_power_mw_mva[idx] = _UNA_decode_floating_unit(una_electrical_power[idx], &UNA_FLOATING_UNIT_ELECTRICAL_POWER);
+    }
 }
 
 /*******************************************************************/
 uint32_t UNA_convert_mwh_mvah(int32_t electrical_energy_mwh_mvah) {
+    return _UNA_encode_floating_unit(electrical_energy_mwh_mvah, &UNA_FLOATING_UNIT_ELECTRICAL_ENERGY, UNA_RECIPROCAL_ENABLE);
+}
+
+/*******************************************************************/
+void UNA_convert_mwh_mvah_batch(const int32_t* electrical_energy_mwh_mvah, uint32_t* una_electrical_energy, uint32_t size) {
     // Local variables.
-    UNA_electrical_energy_t una_electrical_energy;
-    uint32_t absolute_value = 0;
-    // Read absolute value.
-    MATH_abs(electrical_energy_mwh_mvah, absolute_value, uint32_t);
-    // Select sign.
-    una_electrical_energy.sign = (electrical_energy_mwh_mvah < 0) ? UNA_SIGN_NEGATIVE : UNA_SIGN_POSITIVE;
-    // Select unit.
-    if (absolute_value < (0b1 << UNA_ELECTRICAL_ENERGY_VALUE_SIZE_BITS)) {
-        una_electrical_energy.unit = UNA_ELECTRICAL_ENERGY_UNIT_MWH_MVAH;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((electrical_energy_mwh_mvah == NULL) || (una_electrical_energy == NULL)) {
+        return;
     }
-    else {
-        absolute_value /= UNA_MWH_MVAH_PER_DWH_DVAH;
-        if (absolute_value < (0b1 << UNA_ELECTRICAL_ENERGY_VALUE_SIZE_BITS)) {
-            una_electrical_energy.unit = UNA_ELECTRICAL_ENERGY_UNIT_DWH_DVAH;
-        }
-        else {
-            absolute_value /= UNA_DWH_DVAH_PER_WH_VAH;
-            if (absolute_value < (0b1 << UNA_ELECTRICAL_ENERGY_VALUE_SIZE_BITS)) {
-                una_electrical_energy.unit = UNA_ELECTRICAL_ENERGY_UNIT_WH_VAH;
-            }
-            else {
-                absolute_value /= UNA_WH_VAH_PER_DAWH_DAVAH;
-                una_electrical_energy.unit = UNA_ELECTRICAL_ENERGY_UNIT_DAWH_DAVAH;
-            }
-        }
+    for (idx = 0; idx < size; idx++) {
+        una_electrical_energy[idx] = _UNA_encode_floating_unit(electrical_energy_mwh_mvah[idx], &UNA_FLOATING_UNIT_ELECTRICAL_ENERGY, 1);
     }
-    una_electrical_energy.value = absolute_value;
-    return (una_electrical_energy.representation);
 }
 
 /*******************************************************************/
 int32_t UNA_get_mwh_mvah(uint32_t una_electrical_energy) {
+    return _UNA_decode_floating_unit(una_electrical_energy, &UNA_FLOATING_UNIT_ELECTRICAL_ENERGY);
+}
+
+/*******************************************************************/
+void UNA_get_mwh_mvah_batch(const uint32_t* una_electrical_energy, int32_t* electrical_energy_mwh_mvah, uint32_t size) {
     // Local variables.
-    int32_t electrical_energy_mwh_mvah = 0;
-    int32_t absolute_value = 0;
-    int32_t sign_multiplicator = 0;
-    uint32_t local_una_electrical_energy = una_electrical_energy;
-    UNA_electrical_energy_unit_t unit = UNA_ELECTRICAL_ENERGY_UNIT_MWH_MVAH;
-    UNA_sign_t sign = UNA_SIGN_POSITIVE;
-    // Parse fields.
-    sign = ((UNA_electrical_energy_t*) &local_una_electrical_energy)->sign;
-    unit = ((UNA_electrical_energy_t*) &local_una_electrical_energy)->unit;
-    absolute_value = (int32_t) ((UNA_electrical_energy_t*) &local_una_electrical_energy)->value;
-    // Compute multiplicator.
-    sign_multiplicator = (sign == UNA_SIGN_NEGATIVE) ? (-1) : (1);
-    // Compute seconds.
-    switch (unit) {
-    case UNA_ELECTRICAL_ENERGY_UNIT_MWH_MVAH:
-        electrical_energy_mwh_mvah = (absolute_value * sign_multiplicator);
-        break;
-    case UNA_ELECTRICAL_ENERGY_UNIT_DWH_DVAH:
-        electrical_energy_mwh_mvah = (UNA_MWH_MVAH_PER_DWH_DVAH * absolute_value * sign_multiplicator);
-        break;
-    case UNA_ELECTRICAL_ENERGY_UNIT_WH_VAH:
-        electrical_energy_mwh_mvah = (UNA_MWH_MVAH_PER_DWH_DVAH * UNA_DWH_DVAH_PER_WH_VAH * absolute_value * sign_multiplicator);
-        break;
-    default:
-        electrical_energy_mwh_mvah = (UNA_MWH_MVAH_PER_DWH_DVAH * UNA_DWH_DVAH_PER_WH_VAH * UNA_WH_VAH_PER_DAWH_DAVAH * absolute_value * sign_multiplicator);
-        break;
-    }
-    return electrical_energy_mwh_mvah;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_electrical_energy == NULL) || (electrical_energy_mwh_mvah == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        electrical_energy_mwh_mvah[idx] = _UNA_decode_floating_unit(una_electrical_energy[idx], &UNA_FLOATING_UNIT_ELECTRICAL_ENERGY);
+    }
 }
 
 /*******************************************************************/
@@ -522,6 +706,9 @@ uint32_t UNA_convert_power_factor(int32_t power_factor) {
 
 /*******************************************************************/
 int32_t UNA_get_power_factor(uint32_t una_power_factor) {
+#ifdef UNA_LIB_USE_DECODE_TABLES
+    return _UNA_decode_power_factor(una_power_factor);
+#else
     // Local variables.
     int32_t power_factor = 0;
     uint32_t value = 0;
@@ -533,6 +720,20 @@ int32_t UNA_get_power_factor(uint32_t una_power_factor) {
     // Check sign.
     power_factor = (sign == UNA_SIGN_POSITIVE) ? ((int32_t) value) : ((-1) * ((int32_t) value));
     return power_factor;
+#endif
+}
+
+/*******************************************************************/
+void UNA_get_power_factor_batch(const uint32_t* una_power_factor, int32_t* power_factor, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_power_factor == NULL) || (power_factor == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        power_factor[idx] = _UNA_decode_power_factor(una_power_factor[idx]);
+    }
 }
 
 /*******************************************************************/
@@ -545,4 +746,143 @@ int32_t UNA_get_dbm(uint32_t una_rf_power) {
     return ((int32_t) (una_rf_power - UNA_RF_POWER_OFFSET));
 }
 
+/*******************************************************************/
+void UNA_get_dbm_batch(const uint32_t* una_rf_power, int32_t* rf_power_dbm, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_rf_power == NULL) || (rf_power_dbm == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        rf_power_dbm[idx] = ((int32_t) (una_rf_power[idx] - UNA_RF_POWER_OFFSET));
+    }
+}
+
+#ifdef UNA_LIB_USE_FLOAT
+/*******************************************************************/
+float64_t UNA_get_v(uint32_t una_voltage) {
+    return _UNA_decode_floating_unit_si(una_voltage, &UNA_FLOATING_UNIT_VOLTAGE, UNA_VOLTAGE_UNIT_SCALE);
+}
+
+/*******************************************************************/
+void UNA_get_v_batch(const uint32_t* una_voltage, float64_t* voltage_v, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_voltage == NULL) || (voltage_v == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        voltage_v[idx] = _UNA_decode_floating_unit_si(una_voltage[idx], &UNA_FLOATING_UNIT_VOLTAGE, UNA_VOLTAGE_UNIT_SCALE);
+    }
+}
+
+/*******************************************************************/
+void UNA_get_v_batch_float32(const uint32_t* una_voltage, float32_t* voltage_v, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_voltage == NULL) || (voltage_v == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        voltage_v[idx] = (float32_t) _UNA_decode_floating_unit_si(una_voltage[idx], &UNA_FLOATING_UNIT_VOLTAGE, UNA_VOLTAGE_UNIT_SCALE);
+    }
+}
+
+/*******************************************************************/
+float64_t UNA_get_a(uint32_t una_current) {
+    return _UNA_decode_floating_unit_si(una_current, &UNA_FLOATING_UNIT_CURRENT, UNA_CURRENT_UNIT_SCALE);
+}
+
+/*******************************************************************/
+void UNA_get_a_batch(const uint32_t* una_current, float64_t* current_a, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_current == NULL) || (current_a == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        current_a[idx] = _UNA_decode_floating_unit_si(una_current[idx], &UNA_FLOATING_UNIT_CURRENT, UNA_CURRENT_UNIT_SCALE);
+    }
+}
+
+/*******************************************************************/
+void UNA_get_a_batch_float32(const uint32_t* una_current, float32_t* current_a, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_current == NULL) || (current_a == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        current_a[idx] = (float32_t) _UNA_decode_floating_unit_si(una_current[idx], &UNA_FLOATING_UNIT_CURRENT, UNA_CURRENT_UNIT_SCALE);
+    }
+}
+
+/*******************************************************************/
+float64_t UNA_get_w_va(uint32_t una_electrical_power) {
+    return _UNA_decode_floating_unit_si(una_electrical_power, &UNA_FLOATING_UNIT_ELECTRICAL_POWER, UNA_ELECTRICAL_POWER_UNIT_SCALE);
+}
+
+/*******************************************************************/
+void UNA_get_w_va_batch(const uint32_t* una_electrical_power, float64_t* electrical_power_w_va, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_electrical_power == NULL) || (electrical_power_w_va == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        electrical_power_w_va[idx] = _UNA_decode_floating_unit_si(una_electrical_power[idx], &UNA_FLOATING_UNIT_ELECTRICAL_POWER, UNA_ELECTRICAL_POWER_UNIT_SCALE);
+    }
+}
+
+/*******************************************************************/
+void UNA_get_w_va_batch_float32(const uint32_t* una_electrical_power, float32_t* electrical_power_w_va, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_electrical_power == NULL) || (electrical_power_w_va == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        electrical_power_w_va[idx] = (float32_t) _UNA_decode_floating_unit_si(una_electrical_power[idx], &UNA_FLOATING_UNIT_ELECTRICAL_POWER, UNA_ELECTRICAL_POWER_UNIT_SCALE);
+    }
+}
+
+/*******************************************************************/
+float64_t UNA_get_wh_vah(uint32_t una_electrical_energy) {
+    return _UNA_decode_floating_unit_si(una_electrical_energy, &UNA_FLOATING_UNIT_ELECTRICAL_ENERGY, UNA_ELECTRICAL_ENERGY_UNIT_SCALE);
+}
+
+/*******************************************************************/
+void UNA_get_wh_vah_batch(const uint32_t* una_electrical_energy, float64_t* electrical_energy_wh_vah, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_electrical_energy == NULL) || (electrical_energy_wh_vah == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        electrical_energy_wh_vah[idx] = _UNA_decode_floating_unit_si(una_electrical_energy[idx], &UNA_FLOATING_UNIT_ELECTRICAL_ENERGY, UNA_ELECTRICAL_ENERGY_UNIT_SCALE);
+    }
+}
+
+/*******************************************************************/
+void UNA_get_wh_vah_batch_float32(const uint32_t* una_electrical_energy, float32_t* electrical_energy_wh_vah, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((una_electrical_energy == NULL) || (electrical_energy_wh_vah == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        electrical_energy_wh_vah[idx] = (float32_t) _UNA_decode_floating_unit_si(una_electrical_energy[idx], &UNA_FLOATING_UNIT_ELECTRICAL_ENERGY, UNA_ELECTRICAL_ENERGY_UNIT_SCALE);
+    }
+}
+#endif
+
 #endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,163 @@
+/*
+ * una_aggregate.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_aggregate.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA AGGREGATE local macros ***/
+
+#define UNA_AGGREGATE_DEQUE_MINIMUM     0
+#define UNA_AGGREGATE_DEQUE_MAXIMUM     1
+
+/*** UNA AGGREGATE local functions ***/
+
+/*******************************************************************/
+static inline uint32_t _UNA_AGGREGATE_deque_back(UNA_aggregate_t* aggregate, UNA_aggregate_deque_t* deque) {
+    return (deque->index_table[(deque->head + deque->count - 1) % aggregate->window_size]);
+}
+
+/*******************************************************************/
+static inline void _UNA_AGGREGATE_deque_push(UNA_aggregate_t* aggregate, UNA_aggregate_deque_t* deque, uint16_t sample_index, int32_t sample, uint8_t deque_type) {
+    // Local variables.
+    int32_t back_sample = 0;
+    // Remove the samples which can not be the extremum anymore.
+    while (deque->count != 0) {
+        back_sample = aggregate->sample_table[_UNA_AGGREGATE_deque_back(aggregate, deque)];
+        if ((deque_type == UNA_AGGREGATE_DEQUE_MINIMUM) ? (back_sample < sample) : (back_sample > sample)) {
+            break;
+        }
+        deque->count--;
+    }
+    deque->index_table[(deque->head + deque->count) % aggregate->window_size] = sample_index;
+    deque->count++;
+}
+
+/*******************************************************************/
+static inline void _UNA_AGGREGATE_deque_evict(UNA_aggregate_t* aggregate, UNA_aggregate_deque_t* deque, uint16_t sample_index) {
+    // Remove the front sample if it leaves the window, all the samples of the deque have a different index.
+    if ((deque->count != 0) && (deque->index_table[deque->head] == sample_index)) {
+        deque->head = (uint16_t) ((deque->head + 1) % aggregate->window_size);
+        deque->count--;
+    }
+}
+
+/*** UNA AGGREGATE functions ***/
+
+/*******************************************************************/
+UNA_AGGREGATE_status_t UNA_AGGREGATE_init(UNA_aggregate_t* aggregate, UNA_get_physical_data_t get, int32_t* sample_table, uint32_t* min_deque_table, uint32_t* max_deque_table, uint16_t window_size) {
+    // Local variables.
+    UNA_AGGREGATE_status_t status = UNA_AGGREGATE_SUCCESS;
+    // Check parameters.
+    if ((aggregate == NULL) || (get == NULL) || (sample_table == NULL) || (min_deque_table == NULL) || (max_deque_table == NULL)) {
+        status = UNA_AGGREGATE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (window_size == 0) {
+        status = UNA_AGGREGATE_ERROR_SIZE;
+        goto errors;
+    }
+    aggregate->get = get;
+    aggregate->sample_table = sample_table;
+    aggregate->window_size = window_size;
+    aggregate->min_deque.index_table = min_deque_table;
+    aggregate->max_deque.index_table = max_deque_table;
+    UNA_AGGREGATE_reset(aggregate);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void UNA_AGGREGATE_reset(UNA_aggregate_t* aggregate) {
+    // Check parameter.
+    if (aggregate == NULL) {
+        return;
+    }
+    aggregate->sample_index = 0;
+    aggregate->sample_count = 0;
+    aggregate->sum = 0;
+    aggregate->min_deque.head = 0;
+    aggregate->min_deque.count = 0;
+    aggregate->max_deque.head = 0;
+    aggregate->max_deque.count = 0;
+}
+
+/*******************************************************************/
+void UNA_AGGREGATE_update(UNA_aggregate_t* aggregate, uint32_t una_representation) {
+    // Local variables.
+    uint16_t sample_index = 0;
+    int32_t sample = 0;
+    // Check parameter.
+    if ((aggregate == NULL) || (aggregate->sample_table == NULL)) {
+        return;
+    }
+    sample_index = aggregate->sample_index;
+    // Decode only when the representation changed, polled values are often stable.
+    if ((aggregate->sample_count == 0) || (una_representation != aggregate->last_una_representation)) {
+        aggregate->last_una_representation = una_representation;
+        aggregate->last_physical_data = aggregate->get(una_representation);
+    }
+    sample = aggregate->last_physical_data;
+    // Evict oldest sample, which is stored at the insertion index once the window is full.
+    if (aggregate->sample_count >= aggregate->window_size) {
+        aggregate->sum -= aggregate->sample_table[sample_index];
+        _UNA_AGGREGATE_deque_evict(aggregate, &(aggregate->min_deque), sample_index);
+        _UNA_AGGREGATE_deque_evict(aggregate, &(aggregate->max_deque), sample_index);
+    }
+    else {
+        aggregate->sample_count++;
+    }
+    // Insert new sample.
+    aggregate->sample_table[sample_index] = sample;
+    aggregate->sum += sample;
+    _UNA_AGGREGATE_deque_push(aggregate, &(aggregate->min_deque), sample_index, sample, UNA_AGGREGATE_DEQUE_MINIMUM);
+    _UNA_AGGREGATE_deque_push(aggregate, &(aggregate->max_deque), sample_index, sample, UNA_AGGREGATE_DEQUE_MAXIMUM);
+    aggregate->sample_index = (uint16_t) ((sample_index + 1) % aggregate->window_size);
+}
+
+/*******************************************************************/
+void UNA_AGGREGATE_update_batch(UNA_aggregate_t* aggregate_table, const uint32_t* una_representation, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((aggregate_table == NULL) || (una_representation == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < size; idx++) {
+        UNA_AGGREGATE_update(&(aggregate_table[idx]), una_representation[idx]);
+    }
+}
+
+/*******************************************************************/
+UNA_AGGREGATE_status_t UNA_AGGREGATE_get(UNA_aggregate_t* aggregate, UNA_aggregate_result_t* result) {
+    // Local variables.
+    UNA_AGGREGATE_status_t status = UNA_AGGREGATE_SUCCESS;
+    // Check parameters.
+    if ((aggregate == NULL) || (result == NULL)) {
+        status = UNA_AGGREGATE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (aggregate->sample_count == 0) {
+        status = UNA_AGGREGATE_ERROR_EMPTY;
+        goto errors;
+    }
+    result->count = aggregate->sample_count;
+    result->min = aggregate->sample_table[aggregate->min_deque.index_table[aggregate->min_deque.head]];
+    result->max = aggregate->sample_table[aggregate->max_deque.index_table[aggregate->max_deque.head]];
+    result->mean = (int32_t) (aggregate->sum / ((int64_t) result->count));
+    result->last = aggregate->last_physical_data;
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
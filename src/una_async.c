@@ -0,0 +1,232 @@
+/*
+ * una_async.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_async.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+#include "una_trace.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA ASYNC local functions ***/
+
+/*******************************************************************/
+static void _UNA_ASYNC_complete(UNA_async_t* engine, UNA_async_transaction_t* transaction, UNA_access_status_t access_status) {
+    // Local variables.
+    UNA_ASYNC_completion_cb_t completion_callback = transaction->completion_callback;
+    UNA_access_parameters_t access_params = transaction->access_params;
+    uint32_t reg_value = transaction->reg_value;
+    void* context = transaction->context;
+    // Release transaction before calling the callback, so that it can submit a new access.
+    transaction->state = UNA_ASYNC_TRANSACTION_STATE_FREE;
+    engine->pending_count--;
+    access_status.type = transaction->access_type;
+    UNA_TRACE_STOP(UNA_TRACE_STAGE_TOTAL, access_params.node_addr, transaction->trace_submit_timestamp);
+    if (completion_callback != NULL) {
+        completion_callback(&access_params, reg_value, access_status, context);
+    }
+}
+
+/*******************************************************************/
+static uint8_t _UNA_ASYNC_pop(UNA_async_t* engine, UNA_async_bus_t* bus) {
+    // Local variables.
+    uint8_t transaction_index = bus->head_index;
+    // Remove head of the bus FIFO.
+    if (transaction_index != UNA_ASYNC_INDEX_NONE) {
+        bus->head_index = engine->transaction_table[transaction_index].next_index;
+        if (bus->head_index == UNA_ASYNC_INDEX_NONE) {
+            bus->tail_index = UNA_ASYNC_INDEX_NONE;
+        }
+    }
+    return transaction_index;
+}
+
+/*******************************************************************/
+static void _UNA_ASYNC_process_bus(UNA_async_t* engine, uint8_t bus_index, uint32_t now_ms) {
+    // Local variables.
+    UNA_async_bus_t* bus = &(engine->bus_table[bus_index]);
+    UNA_async_transaction_t* transaction = NULL;
+    UNA_access_status_t access_status;
+    uint8_t transaction_index = 0;
+    // Check current access.
+    if (bus->current_index != UNA_ASYNC_INDEX_NONE) {
+        transaction = &(engine->transaction_table[bus->current_index]);
+        access_status.all = 0;
+        if (engine->transport->poll(bus_index, &(transaction->reg_value), &access_status) != 0) {
+            UNA_TRACE_STOP(UNA_TRACE_STAGE_REPLY, transaction->access_params.node_addr, transaction->trace_stage_timestamp);
+            bus->current_index = UNA_ASYNC_INDEX_NONE;
+            _UNA_ASYNC_complete(engine, transaction, access_status);
+        }
+        else if ((now_ms - transaction->send_time_ms) >= transaction->access_params.reply_params.timeout_ms) {
+            if (engine->transport->abort != NULL) {
+                engine->transport->abort(bus_index);
+            }
+            UNA_TRACE_STOP(UNA_TRACE_STAGE_REPLY, transaction->access_params.node_addr, transaction->trace_stage_timestamp);
+            bus->current_index = UNA_ASYNC_INDEX_NONE;
+            access_status.all = 0;
+            access_status.reply_timeout = 1;
+            _UNA_ASYNC_complete(engine, transaction, access_status);
+        }
+        else {
+            // Reply still pending.
+            return;
+        }
+    }
+    // Start next access, skipping the ones which already exceeded the sequence timeout.
+    while (bus->current_index == UNA_ASYNC_INDEX_NONE) {
+        transaction_index = _UNA_ASYNC_pop(engine, bus);
+        if (transaction_index == UNA_ASYNC_INDEX_NONE) {
+            break;
+        }
+        transaction = &(engine->transaction_table[transaction_index]);
+        if ((now_ms - transaction->submit_time_ms) >= engine->sequence_timeout_ms) {
+            access_status.all = 0;
+            access_status.sequence_timeout = 1;
+            _UNA_ASYNC_complete(engine, transaction, access_status);
+            continue;
+        }
+        transaction->state = UNA_ASYNC_TRANSACTION_STATE_IN_PROGRESS;
+        transaction->send_time_ms = now_ms;
+        UNA_TRACE_STOP(UNA_TRACE_STAGE_QUEUE, transaction->access_params.node_addr, transaction->trace_submit_timestamp);
+        UNA_TRACE_START(transaction->trace_stage_timestamp);
+        engine->transport->send(bus_index, transaction->access_type, &(transaction->access_params), transaction->reg_value, transaction->reg_mask);
+        UNA_TRACE_STOP(UNA_TRACE_STAGE_TX, transaction->access_params.node_addr, transaction->trace_stage_timestamp);
+        UNA_TRACE_START(transaction->trace_stage_timestamp);
+        // Accesses without reply are completed as soon as they are sent.
+        if (transaction->access_params.reply_params.type == UNA_REPLY_TYPE_NONE) {
+            access_status.all = 0;
+            _UNA_ASYNC_complete(engine, transaction, access_status);
+            continue;
+        }
+        bus->current_index = transaction_index;
+    }
+}
+
+/*** UNA ASYNC functions ***/
+
+/*******************************************************************/
+UNA_ASYNC_status_t UNA_ASYNC_init(UNA_async_t* engine, const UNA_async_transport_t* transport, UNA_async_transaction_t* transaction_table, uint8_t transaction_number, UNA_async_bus_t* bus_table, uint8_t bus_number, uint32_t sequence_timeout_ms) {
+    // Local variables.
+    UNA_ASYNC_status_t status = UNA_ASYNC_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((engine == NULL) || (transport == NULL) || (transaction_table == NULL) || (bus_table == NULL)) {
+        status = UNA_ASYNC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((transport->send == NULL) || (transport->poll == NULL)) {
+        status = UNA_ASYNC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((transaction_number == 0) || (transaction_number == UNA_ASYNC_INDEX_NONE) || (bus_number == 0) || (sequence_timeout_ms == 0)) {
+        status = UNA_ASYNC_ERROR_SIZE;
+        goto errors;
+    }
+    // Init context.
+    engine->transport = transport;
+    engine->transaction_table = transaction_table;
+    engine->transaction_number = transaction_number;
+    engine->bus_table = bus_table;
+    engine->bus_number = bus_number;
+    engine->sequence_timeout_ms = sequence_timeout_ms;
+    engine->pending_count = 0;
+    for (idx = 0; idx < transaction_number; idx++) {
+        transaction_table[idx].state = UNA_ASYNC_TRANSACTION_STATE_FREE;
+    }
+    for (idx = 0; idx < bus_number; idx++) {
+        bus_table[idx].current_index = UNA_ASYNC_INDEX_NONE;
+        bus_table[idx].head_index = UNA_ASYNC_INDEX_NONE;
+        bus_table[idx].tail_index = UNA_ASYNC_INDEX_NONE;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_ASYNC_status_t UNA_ASYNC_submit(UNA_async_t* engine, uint8_t bus_index, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask, UNA_ASYNC_completion_cb_t completion_callback, void* context, uint32_t now_ms) {
+    // Local variables.
+    UNA_ASYNC_status_t status = UNA_ASYNC_SUCCESS;
+    UNA_async_transaction_t* transaction = NULL;
+    UNA_async_bus_t* bus = NULL;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((engine == NULL) || (access_params == NULL)) {
+        status = UNA_ASYNC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (bus_index >= engine->bus_number) {
+        status = UNA_ASYNC_ERROR_BUS_INDEX;
+        goto errors;
+    }
+    if ((access_type != UNA_ACCESS_TYPE_READ) && (access_type != UNA_ACCESS_TYPE_WRITE)) {
+        status = UNA_ASYNC_ERROR_ACCESS_TYPE;
+        goto errors;
+    }
+    // Search free transaction.
+    for (idx = 0; idx < engine->transaction_number; idx++) {
+        if (engine->transaction_table[idx].state == UNA_ASYNC_TRANSACTION_STATE_FREE) {
+            break;
+        }
+    }
+    if (idx >= engine->transaction_number) {
+        status = UNA_ASYNC_ERROR_POOL_FULL;
+        goto errors;
+    }
+    transaction = &(engine->transaction_table[idx]);
+    transaction->state = UNA_ASYNC_TRANSACTION_STATE_QUEUED;
+    transaction->bus_index = bus_index;
+    transaction->next_index = UNA_ASYNC_INDEX_NONE;
+    transaction->access_type = access_type;
+    transaction->access_params = (*access_params);
+    transaction->reg_value = reg_value;
+    transaction->reg_mask = reg_mask;
+    transaction->submit_time_ms = now_ms;
+    transaction->send_time_ms = now_ms;
+    transaction->completion_callback = completion_callback;
+    transaction->context = context;
+    UNA_TRACE_START(transaction->trace_submit_timestamp);
+    // Append to the bus FIFO.
+    bus = &(engine->bus_table[bus_index]);
+    if (bus->tail_index == UNA_ASYNC_INDEX_NONE) {
+        bus->head_index = idx;
+    }
+    else {
+        engine->transaction_table[bus->tail_index].next_index = idx;
+    }
+    bus->tail_index = idx;
+    engine->pending_count++;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_ASYNC_status_t UNA_ASYNC_process(UNA_async_t* engine, uint32_t now_ms) {
+    // Local variables.
+    UNA_ASYNC_status_t status = UNA_ASYNC_SUCCESS;
+    uint8_t bus_index = 0;
+    // Check parameter.
+    if (engine == NULL) {
+        status = UNA_ASYNC_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    for (bus_index = 0; bus_index < engine->bus_number; bus_index++) {
+        _UNA_ASYNC_process_bus(engine, bus_index, now_ms);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+uint8_t UNA_ASYNC_get_pending_count(UNA_async_t* engine) {
+    return ((engine == NULL) ? 0 : engine->pending_count);
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,300 @@
+/*
+ * una_cache.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_cache.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+#include "una_lockfree.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA CACHE local macros ***/
+
+#define UNA_CACHE_KEY(node_addr, reg_addr)  ((uint16_t) ((((uint16_t) (node_addr)) << 8) | ((uint16_t) (reg_addr))))
+
+/*** UNA CACHE local functions ***/
+
+/*******************************************************************/
+static UNA_cache_entry_t* _UNA_CACHE_find(UNA_cache_t* cache, uint16_t key) {
+    // Local variables.
+    UNA_cache_entry_t* entry = NULL;
+    uint16_t entry_key = 0;
+    uint16_t idx = UNA_LOCKFREE_HASH(key);
+    uint16_t probe = 0;
+    // Linear probing, entries are never removed so the first empty slot ends the search.
+    for (probe = 0; probe < cache->size; probe++) {
+        entry = &(cache->entry_table[(idx + probe) & (cache->size - 1)]);
+        entry_key = __atomic_load_n(&(entry->key), __ATOMIC_ACQUIRE);
+        if (entry_key == key) {
+            return entry;
+        }
+        if (entry_key == UNA_CACHE_KEY_NONE) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************/
+static UNA_cache_entry_t* _UNA_CACHE_find_or_insert(UNA_cache_t* cache, uint16_t key) {
+    // Local variables.
+    UNA_cache_entry_t* entry = NULL;
+    uint16_t idx = UNA_LOCKFREE_HASH(key);
+    uint16_t probe = 0;
+    for (probe = 0; probe < cache->size; probe++) {
+        entry = &(cache->entry_table[(idx + probe) & (cache->size - 1)]);
+        if (entry->key == key) {
+            return entry;
+        }
+        if (entry->key == UNA_CACHE_KEY_NONE) {
+            // Entry content is initialized before the key is published to readers.
+            entry->valid = 0;
+            entry->value = 0;
+            entry->dirty_mask = 0;
+            entry->timestamp_ms = 0;
+            __atomic_store_n(&(entry->key), key, __ATOMIC_RELEASE);
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/*** UNA CACHE functions ***/
+
+/*******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_init(UNA_cache_t* cache, UNA_cache_entry_t* entry_table, uint16_t size) {
+    // Local variables.
+    UNA_CACHE_status_t status = UNA_CACHE_SUCCESS;
+    // Check parameters.
+    if ((cache == NULL) || (entry_table == NULL)) {
+        status = UNA_CACHE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((size == 0) || ((size & (size - 1)) != 0)) {
+        status = UNA_CACHE_ERROR_SIZE;
+        goto errors;
+    }
+    cache->entry_table = entry_table;
+    cache->size = size;
+    UNA_CACHE_reset(cache);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void UNA_CACHE_reset(UNA_cache_t* cache) {
+    // Local variables.
+    uint16_t idx = 0;
+    // Check parameter.
+    if ((cache == NULL) || (cache->entry_table == NULL)) {
+        return;
+    }
+    for (idx = 0; idx < cache->size; idx++) {
+        cache->entry_table[idx].sequence = 0;
+        cache->entry_table[idx].key = UNA_CACHE_KEY_NONE;
+        cache->entry_table[idx].valid = 0;
+    }
+}
+
+/*******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_update(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value, uint32_t timestamp_ms) {
+    // Local variables.
+    UNA_CACHE_status_t status = UNA_CACHE_SUCCESS;
+    UNA_cache_entry_t* entry = NULL;
+    // Check parameters.
+    if (cache == NULL) {
+        status = UNA_CACHE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_CACHE_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    entry = _UNA_CACHE_find_or_insert(cache, UNA_CACHE_KEY(node_addr, reg_addr));
+    if (entry == NULL) {
+        status = UNA_CACHE_ERROR_FULL;
+        goto errors;
+    }
+    UNA_LOCKFREE_write_begin(&(entry->sequence));
+    // Keep the locally modified bits which have not been written on the bus yet.
+    entry->value = (reg_value & (~entry->dirty_mask)) | (entry->value & entry->dirty_mask);
+    entry->timestamp_ms = timestamp_ms;
+    entry->valid = 1;
+    UNA_LOCKFREE_write_end(&(entry->sequence));
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_write(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask) {
+    // Local variables.
+    UNA_CACHE_status_t status = UNA_CACHE_SUCCESS;
+    UNA_cache_entry_t* entry = NULL;
+    // Check parameters.
+    if (cache == NULL) {
+        status = UNA_CACHE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_CACHE_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    entry = _UNA_CACHE_find_or_insert(cache, UNA_CACHE_KEY(node_addr, reg_addr));
+    if (entry == NULL) {
+        status = UNA_CACHE_ERROR_FULL;
+        goto errors;
+    }
+    UNA_LOCKFREE_write_begin(&(entry->sequence));
+    entry->value = (entry->value & (~reg_mask)) | (reg_value & reg_mask);
+    entry->dirty_mask |= reg_mask;
+    UNA_LOCKFREE_write_end(&(entry->sequence));
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_clear_dirty(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_mask) {
+    // Local variables.
+    UNA_CACHE_status_t status = UNA_CACHE_SUCCESS;
+    UNA_cache_entry_t* entry = NULL;
+    // Check parameters.
+    if (cache == NULL) {
+        status = UNA_CACHE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    entry = _UNA_CACHE_find(cache, UNA_CACHE_KEY(node_addr, reg_addr));
+    if (entry == NULL) {
+        status = UNA_CACHE_ERROR_MISS;
+        goto errors;
+    }
+    UNA_LOCKFREE_write_begin(&(entry->sequence));
+    entry->dirty_mask &= (~reg_mask);
+    UNA_LOCKFREE_write_end(&(entry->sequence));
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void UNA_CACHE_invalidate(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr) {
+    // Local variables.
+    UNA_cache_entry_t* entry = NULL;
+    // Check parameter.
+    if (cache == NULL) {
+        return;
+    }
+    entry = _UNA_CACHE_find(cache, UNA_CACHE_KEY(node_addr, reg_addr));
+    if (entry != NULL) {
+        UNA_LOCKFREE_write_begin(&(entry->sequence));
+        entry->valid = 0;
+        UNA_LOCKFREE_write_end(&(entry->sequence));
+    }
+}
+
+/*******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_read(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t max_age_ms, uint32_t now_ms, uint32_t* reg_value, uint32_t* dirty_mask) {
+    // Local variables.
+    UNA_CACHE_status_t status = UNA_CACHE_SUCCESS;
+    UNA_cache_entry_t* entry = NULL;
+    uint32_t sequence = 0;
+    uint32_t value = 0;
+    uint32_t mask = 0;
+    uint32_t timestamp_ms = 0;
+    uint8_t valid = 0;
+    // Check parameters.
+    if ((cache == NULL) || (reg_value == NULL)) {
+        status = UNA_CACHE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    entry = _UNA_CACHE_find(cache, UNA_CACHE_KEY(node_addr, reg_addr));
+    if (entry == NULL) {
+        status = UNA_CACHE_ERROR_MISS;
+        goto errors;
+    }
+    // Copy entry until a consistent snapshot is obtained.
+    do {
+        sequence = UNA_LOCKFREE_read_begin(&(entry->sequence));
+        valid = __atomic_load_n(&(entry->valid), __ATOMIC_RELAXED);
+        value = __atomic_load_n(&(entry->value), __ATOMIC_RELAXED);
+        mask = __atomic_load_n(&(entry->dirty_mask), __ATOMIC_RELAXED);
+        timestamp_ms = __atomic_load_n(&(entry->timestamp_ms), __ATOMIC_RELAXED);
+    }
+    while (UNA_LOCKFREE_read_retry(&(entry->sequence), sequence) != 0);
+    // Check validity and age.
+    if ((valid == 0) || ((now_ms - timestamp_ms) > max_age_ms)) {
+        status = UNA_CACHE_ERROR_MISS;
+        goto errors;
+    }
+    (*reg_value) = value;
+    if (dirty_mask != NULL) {
+        (*dirty_mask) = mask;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_read_dirty(UNA_cache_t* cache, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t* reg_value, uint32_t* dirty_mask) {
+    // Local variables.
+    UNA_CACHE_status_t status = UNA_CACHE_SUCCESS;
+    UNA_cache_entry_t* entry = NULL;
+    uint32_t sequence = 0;
+    uint32_t value = 0;
+    uint32_t mask = 0;
+    // Check parameters.
+    if ((cache == NULL) || (reg_value == NULL) || (dirty_mask == NULL)) {
+        status = UNA_CACHE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    entry = _UNA_CACHE_find(cache, UNA_CACHE_KEY(node_addr, reg_addr));
+    if (entry == NULL) {
+        status = UNA_CACHE_ERROR_MISS;
+        goto errors;
+    }
+    do {
+        sequence = UNA_LOCKFREE_read_begin(&(entry->sequence));
+        value = __atomic_load_n(&(entry->value), __ATOMIC_RELAXED);
+        mask = __atomic_load_n(&(entry->dirty_mask), __ATOMIC_RELAXED);
+    }
+    while (UNA_LOCKFREE_read_retry(&(entry->sequence), sequence) != 0);
+    (*reg_value) = value;
+    (*dirty_mask) = mask;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_CACHE_status_t UNA_CACHE_read_register(UNA_cache_t* cache, UNA_access_parameters_t* read_params, uint32_t max_age_ms, uint32_t now_ms, UNA_read_register_t read_register, uint32_t* reg_value, UNA_access_status_t* read_status) {
+    // Local variables.
+    UNA_CACHE_status_t status = UNA_CACHE_SUCCESS;
+    // Check parameters.
+    if ((read_params == NULL) || (read_register == NULL) || (read_status == NULL)) {
+        status = UNA_CACHE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    read_status->all = 0;
+    read_status->type = UNA_ACCESS_TYPE_READ;
+    // Try cache first.
+    status = UNA_CACHE_read(cache, read_params->node_addr, read_params->reg_addr, max_age_ms, now_ms, reg_value, NULL);
+    if (status != UNA_CACHE_ERROR_MISS) {
+        goto errors;
+    }
+    // Access bus on cache miss.
+    read_register(read_params, reg_value, read_status);
+    if (read_status->flags != 0) {
+        status = UNA_CACHE_ERROR_ACCESS;
+        goto errors;
+    }
+    status = UNA_CACHE_update(cache, read_params->node_addr, read_params->reg_addr, (*reg_value), now_ms);
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,319 @@
+/*
+ * una_discovery.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_discovery.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+#include "una_async.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA DISCOVERY local macros ***/
+
+#define UNA_DISCOVERY_REGISTER_ADDRESS_NODE_ID  0x00
+
+#define UNA_DISCOVERY_NODE_ID_ADDRESS_SHIFT     0
+#define UNA_DISCOVERY_NODE_ID_BOARD_ID_SHIFT    8
+#define UNA_DISCOVERY_NODE_ID_FIELD_MASK        0xFF
+
+#define UNA_DISCOVERY_RANGE_INDEX_MAX           16
+
+#define UNA_DISCOVERY_TIMEOUT_RTT_FACTOR        2
+
+/*** UNA DISCOVERY local functions ***/
+
+/*******************************************************************/
+static inline uint8_t _UNA_DISCOVERY_get_bit(uint8_t* bit_table, uint8_t node_addr) {
+    return (((bit_table[node_addr >> 3]) >> (node_addr & 0x07)) & 0b1);
+}
+
+/*******************************************************************/
+static inline void _UNA_DISCOVERY_set_bit(uint8_t* bit_table, uint8_t node_addr) {
+    bit_table[node_addr >> 3] |= (0b1 << (node_addr & 0x07));
+}
+
+/*******************************************************************/
+static void _UNA_DISCOVERY_add_probe(UNA_discovery_t* discovery, uint8_t node_addr, UNA_board_id_t board_id, uint8_t bus_index) {
+    discovery->probe_address_table[discovery->probe_number] = node_addr;
+    discovery->probe_board_id_table[discovery->probe_number] = (uint8_t) board_id;
+    discovery->probe_bus_index_table[discovery->probe_number] = bus_index;
+    discovery->probe_number++;
+}
+
+/*******************************************************************/
+static uint8_t _UNA_DISCOVERY_is_probe_skipped(UNA_discovery_t* discovery, UNA_discovery_bus_t* bus) {
+    // Local variables.
+    uint8_t probe_bus_index = discovery->probe_bus_index_table[bus->probe_index];
+    // Skip the nodes already found on this bus, and the nodes known to be on another bus.
+    if (_UNA_DISCOVERY_get_bit(bus->found_table, discovery->probe_address_table[bus->probe_index]) != 0) {
+        return 1;
+    }
+    if ((probe_bus_index != UNA_DISCOVERY_BUS_INDEX_NONE) && (probe_bus_index != bus->bus_index)) {
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static void _UNA_DISCOVERY_build_scan(UNA_discovery_t* discovery) {
+    // Local variables.
+    UNA_board_id_t board_id = UNA_BOARD_ID_ERROR;
+    uint8_t node_index = 0;
+    uint8_t range_index = 0;
+    uint8_t node_addr = 0;
+    // Known boards addresses, by increasing index in range since ranges are filled from their first address.
+    for (range_index = 0; range_index < UNA_DISCOVERY_RANGE_INDEX_MAX; range_index++) {
+        for (node_addr = (UNA_NODE_ADDRESS_MASTER + 1); node_addr < UNA_NODE_ADDRESS_LAST; node_addr++) {
+            board_id = UNA_get_board_id((UNA_node_address_t) node_addr, &node_index);
+            if ((board_id != UNA_BOARD_ID_ERROR) && (node_index == range_index)) {
+                _UNA_DISCOVERY_add_probe(discovery, node_addr, UNA_BOARD_ID_ERROR, UNA_DISCOVERY_BUS_INDEX_NONE);
+            }
+        }
+    }
+    // Unassigned addresses.
+    if (discovery->configuration.full_scan != 0) {
+        for (node_addr = (UNA_NODE_ADDRESS_MASTER + 1); node_addr < UNA_NODE_ADDRESS_LAST; node_addr++) {
+            if (UNA_get_board_id((UNA_node_address_t) node_addr, NULL) == UNA_BOARD_ID_ERROR) {
+                _UNA_DISCOVERY_add_probe(discovery, node_addr, UNA_BOARD_ID_ERROR, UNA_DISCOVERY_BUS_INDEX_NONE);
+            }
+        }
+    }
+}
+
+/*******************************************************************/
+static void _UNA_DISCOVERY_completion_callback(UNA_access_parameters_t* access_params, uint32_t reg_value, UNA_access_status_t access_status, void* context) {
+    // Local variables.
+    UNA_discovery_bus_t* bus = (UNA_discovery_bus_t*) context;
+    UNA_discovery_t* discovery = (UNA_discovery_t*) (bus->discovery);
+    UNA_node_list_t* node_list = discovery->node_list;
+    uint8_t node_addr = (uint8_t) (access_params->node_addr);
+    uint8_t expected_board_id = discovery->probe_board_id_table[bus->probe_index];
+    uint8_t board_id = (uint8_t) ((reg_value >> UNA_DISCOVERY_NODE_ID_BOARD_ID_SHIFT) & UNA_DISCOVERY_NODE_ID_FIELD_MASK);
+    uint32_t rtt_ms = 0;
+    // Release bus.
+    bus->in_flight = 0;
+    bus->probe_index++;
+    if ((access_status.flags != 0) || (_UNA_DISCOVERY_get_bit(bus->found_table, node_addr) != 0)) {
+        return;
+    }
+    // Check node identifier.
+    if ((((reg_value >> UNA_DISCOVERY_NODE_ID_ADDRESS_SHIFT) & UNA_DISCOVERY_NODE_ID_FIELD_MASK) != node_addr) || (board_id >= UNA_BOARD_ID_LAST)) {
+        return;
+    }
+    if ((expected_board_id != UNA_BOARD_ID_ERROR) && (board_id != expected_board_id)) {
+        return;
+    }
+    // Adapt probes timeout to the slowest reply.
+    rtt_ms = (discovery->now_ms - bus->send_time_ms);
+    if (rtt_ms > discovery->rtt_max_ms) {
+        discovery->rtt_max_ms = rtt_ms;
+    }
+    discovery->timeout_ms = (UNA_DISCOVERY_TIMEOUT_RTT_FACTOR * discovery->rtt_max_ms);
+    if (discovery->timeout_ms < discovery->configuration.timeout_min_ms) {
+        discovery->timeout_ms = discovery->configuration.timeout_min_ms;
+    }
+    if (discovery->timeout_ms > discovery->configuration.timeout_max_ms) {
+        discovery->timeout_ms = discovery->configuration.timeout_max_ms;
+    }
+    // Write result, the node list holds one entry per address.
+    _UNA_DISCOVERY_set_bit(bus->found_table, node_addr);
+    if (_UNA_DISCOVERY_get_bit(discovery->listed_table, node_addr) != 0) {
+        discovery->conflict_count++;
+        return;
+    }
+    _UNA_DISCOVERY_set_bit(discovery->listed_table, node_addr);
+    if (node_list->count < UNA_NODE_ADDRESS_LAST) {
+        node_list->list[node_list->count].address = (UNA_node_address_t) node_addr;
+        node_list->list[node_list->count].board_id = (UNA_board_id_t) board_id;
+        node_list->count++;
+    }
+    if (discovery->node_bus_table != NULL) {
+        discovery->node_bus_table[node_addr] = bus->bus_index;
+    }
+}
+
+/*******************************************************************/
+static void _UNA_DISCOVERY_submit(UNA_discovery_t* discovery, UNA_discovery_bus_t* bus) {
+    // Local variables.
+    UNA_access_parameters_t access_params;
+    // Skip the probes which are not relevant for this bus.
+    while ((bus->probe_index < discovery->probe_number) && (_UNA_DISCOVERY_is_probe_skipped(discovery, bus) != 0)) {
+        bus->probe_index++;
+    }
+    if (bus->probe_index >= discovery->probe_number) {
+        return;
+    }
+    access_params.node_addr = (UNA_node_address_t) discovery->probe_address_table[bus->probe_index];
+    access_params.reg_addr = UNA_DISCOVERY_REGISTER_ADDRESS_NODE_ID;
+    access_params.reply_params.type = UNA_REPLY_TYPE_VALUE;
+    access_params.reply_params.timeout_ms = discovery->timeout_ms;
+    // Retry on next call if the transactions pool is full.
+    if (UNA_ASYNC_submit(discovery->engine, bus->bus_index, UNA_ACCESS_TYPE_READ, &access_params, 0, 0, &_UNA_DISCOVERY_completion_callback, bus, discovery->now_ms) == UNA_ASYNC_SUCCESS) {
+        bus->in_flight = 1;
+        bus->send_time_ms = discovery->now_ms;
+        discovery->probe_count++;
+    }
+}
+
+/*** UNA DISCOVERY functions ***/
+
+/*******************************************************************/
+UNA_DISCOVERY_status_t UNA_DISCOVERY_init(UNA_discovery_t* discovery, UNA_async_t* engine, uint8_t* node_bus_table) {
+    // Local variables.
+    UNA_DISCOVERY_status_t status = UNA_DISCOVERY_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((discovery == NULL) || (engine == NULL)) {
+        status = UNA_DISCOVERY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((engine->bus_number == 0) || (engine->bus_number > UNA_DISCOVERY_BUS_NUMBER_MAX)) {
+        status = UNA_DISCOVERY_ERROR_BUS_NUMBER;
+        goto errors;
+    }
+    discovery->engine = engine;
+    discovery->node_bus_table = node_bus_table;
+    discovery->node_list = NULL;
+    discovery->running = 0;
+    discovery->probe_number = 0;
+    discovery->probe_count = 0;
+    discovery->conflict_count = 0;
+    if (node_bus_table != NULL) {
+        for (idx = 0; idx < UNA_NODE_ADDRESS_LAST; idx++) {
+            node_bus_table[idx] = UNA_DISCOVERY_BUS_INDEX_NONE;
+        }
+    }
+    for (idx = 0; idx < UNA_DISCOVERY_BUS_NUMBER_MAX; idx++) {
+        discovery->bus_table[idx].discovery = discovery;
+        discovery->bus_table[idx].bus_index = idx;
+        discovery->bus_table[idx].probe_index = 0;
+        discovery->bus_table[idx].in_flight = 0;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_DISCOVERY_status_t UNA_DISCOVERY_start(UNA_discovery_t* discovery, UNA_discovery_mode_t mode, UNA_discovery_configuration_t* configuration, UNA_node_list_t* node_list, uint32_t now_ms) {
+    // Local variables.
+    UNA_DISCOVERY_status_t status = UNA_DISCOVERY_SUCCESS;
+    uint8_t bus_index = UNA_DISCOVERY_BUS_INDEX_NONE;
+    uint8_t node_addr = 0;
+    uint8_t idx = 0;
+    uint8_t byte_idx = 0;
+    // Check parameters.
+    if ((discovery == NULL) || (configuration == NULL) || (node_list == NULL)) {
+        status = UNA_DISCOVERY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (mode >= UNA_DISCOVERY_MODE_LAST) {
+        status = UNA_DISCOVERY_ERROR_MODE;
+        goto errors;
+    }
+    if ((configuration->timeout_max_ms == 0) || (configuration->timeout_min_ms > configuration->timeout_max_ms)) {
+        status = UNA_DISCOVERY_ERROR_TIMEOUT;
+        goto errors;
+    }
+    if (discovery->running != 0) {
+        status = UNA_DISCOVERY_ERROR_BUSY;
+        goto errors;
+    }
+    discovery->configuration = (*configuration);
+    discovery->node_list = node_list;
+    discovery->start_time_ms = now_ms;
+    discovery->now_ms = now_ms;
+    discovery->timeout_ms = configuration->timeout_max_ms;
+    discovery->rtt_max_ms = 0;
+    discovery->probe_count = 0;
+    discovery->conflict_count = 0;
+    discovery->probe_number = 0;
+    for (byte_idx = 0; byte_idx < sizeof(discovery->listed_table); byte_idx++) {
+        discovery->listed_table[byte_idx] = 0;
+    }
+    for (idx = 0; idx < UNA_DISCOVERY_BUS_NUMBER_MAX; idx++) {
+        discovery->bus_table[idx].probe_index = 0;
+        discovery->bus_table[idx].in_flight = 0;
+        for (byte_idx = 0; byte_idx < sizeof(discovery->bus_table[idx].found_table); byte_idx++) {
+            discovery->bus_table[idx].found_table[byte_idx] = 0;
+        }
+    }
+    // Build probes list before clearing the node list and bus table, which can be the previous result.
+    if (mode == UNA_DISCOVERY_MODE_VERIFY) {
+        for (idx = 0; (idx < node_list->count) && (idx < UNA_NODE_ADDRESS_LAST); idx++) {
+            node_addr = (uint8_t) node_list->list[idx].address;
+            if ((node_addr >= UNA_NODE_ADDRESS_LAST) || (node_list->list[idx].board_id >= UNA_BOARD_ID_LAST)) {
+                continue;
+            }
+            bus_index = UNA_DISCOVERY_BUS_INDEX_NONE;
+            if ((discovery->node_bus_table != NULL) && (discovery->node_bus_table[node_addr] < discovery->engine->bus_number)) {
+                bus_index = discovery->node_bus_table[node_addr];
+            }
+            _UNA_DISCOVERY_add_probe(discovery, node_addr, node_list->list[idx].board_id, bus_index);
+        }
+    }
+    else {
+        _UNA_DISCOVERY_build_scan(discovery);
+    }
+    UNA_reset_node_list(node_list);
+    if (discovery->node_bus_table != NULL) {
+        for (idx = 0; idx < UNA_NODE_ADDRESS_LAST; idx++) {
+            discovery->node_bus_table[idx] = UNA_DISCOVERY_BUS_INDEX_NONE;
+        }
+    }
+    discovery->running = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_DISCOVERY_status_t UNA_DISCOVERY_process(UNA_discovery_t* discovery, uint32_t now_ms, uint8_t* complete) {
+    // Local variables.
+    UNA_DISCOVERY_status_t status = UNA_DISCOVERY_SUCCESS;
+    UNA_discovery_bus_t* bus = NULL;
+    uint8_t budget_elapsed = 0;
+    uint8_t pending = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((discovery == NULL) || (complete == NULL)) {
+        status = UNA_DISCOVERY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*complete) = 0;
+    if (discovery->running == 0) {
+        (*complete) = 1;
+        goto errors;
+    }
+    discovery->now_ms = now_ms;
+    budget_elapsed = ((now_ms - discovery->start_time_ms) >= discovery->configuration.budget_ms) ? 1 : 0;
+    // Submit one probe per idle bus, they are sent immediately by the engine.
+    for (idx = 0; idx < discovery->engine->bus_number; idx++) {
+        bus = &(discovery->bus_table[idx]);
+        if ((bus->in_flight == 0) && (budget_elapsed == 0)) {
+            _UNA_DISCOVERY_submit(discovery, bus);
+        }
+    }
+    UNA_ASYNC_process(discovery->engine, now_ms);
+    // Check completion.
+    for (idx = 0; idx < discovery->engine->bus_number; idx++) {
+        bus = &(discovery->bus_table[idx]);
+        if ((bus->in_flight != 0) || ((budget_elapsed == 0) && (bus->probe_index < discovery->probe_number))) {
+            pending = 1;
+        }
+    }
+    if (pending == 0) {
+        discovery->running = 0;
+        (*complete) = 1;
+    }
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
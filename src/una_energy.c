@@ -0,0 +1,211 @@
+/*
+ * una_energy.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_energy.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+#include "una_lockfree.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA ENERGY local macros ***/
+
+#define UNA_ENERGY_DECODE_CHUNK_SIZE    32
+
+/*** UNA ENERGY local functions ***/
+
+/*******************************************************************/
+static inline int32_t _UNA_ENERGY_get_step(uint32_t una_electrical_energy) {
+    // Resolution of the reading is the multiplier of its unit.
+    return UNA_FLOATING_UNIT_ELECTRICAL_ENERGY.unit_multiplier[(una_electrical_energy >> UNA_FLOATING_UNIT_ELECTRICAL_ENERGY.value_size_bits) & ((0b1UL << UNA_FLOATING_UNIT_ELECTRICAL_ENERGY.unit_size_bits) - 1)];
+}
+
+/*******************************************************************/
+static void _UNA_ENERGY_accumulate(UNA_energy_t* accumulator, UNA_energy_channel_t* channel, int32_t reading_mwh_mvah, int32_t reading_step) {
+    // Local variables.
+    int64_t delta_mwh_mvah = 0;
+    int64_t magnitude_drop = 0;
+    // First reading is the reference.
+    if (channel->initialized == 0) {
+        channel->initialized = 1;
+    }
+    else {
+        delta_mwh_mvah = ((int64_t) reading_mwh_mvah - (int64_t) channel->last_mwh_mvah);
+        magnitude_drop = ((channel->last_mwh_mvah < 0) ? (-((int64_t) channel->last_mwh_mvah)) : ((int64_t) channel->last_mwh_mvah)) - ((reading_mwh_mvah < 0) ? (-((int64_t) reading_mwh_mvah)) : ((int64_t) reading_mwh_mvah));
+        // The meter counter restarted from zero when its sign changes or its magnitude decreases by more than the reading resolution.
+        if (((reading_mwh_mvah > 0) && (channel->last_mwh_mvah < 0)) || ((reading_mwh_mvah < 0) && (channel->last_mwh_mvah > 0)) || (magnitude_drop >= reading_step)) {
+            delta_mwh_mvah = reading_mwh_mvah;
+            channel->reset_count++;
+        }
+        else if (magnitude_drop > 0) {
+            // Value truncated by the switch to a coarser unit: the previous reading remains the reference.
+            delta_mwh_mvah = 0;
+            reading_mwh_mvah = channel->last_mwh_mvah;
+        }
+        channel->total_mwh_mvah += delta_mwh_mvah;
+        if (channel->group_index < accumulator->group_number) {
+            accumulator->group_total_table[channel->group_index] += delta_mwh_mvah;
+        }
+    }
+    channel->last_mwh_mvah = reading_mwh_mvah;
+}
+
+/*** UNA ENERGY functions ***/
+
+/*******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_init(UNA_energy_t* accumulator, UNA_energy_channel_t* channel_table, uint32_t channel_number, int64_t* group_total_table, uint8_t group_number) {
+    // Local variables.
+    UNA_ENERGY_status_t status = UNA_ENERGY_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((accumulator == NULL) || (channel_table == NULL) || ((group_total_table == NULL) && (group_number != 0))) {
+        status = UNA_ENERGY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((channel_number == 0) || (group_number == UNA_ENERGY_GROUP_NONE)) {
+        status = UNA_ENERGY_ERROR_SIZE;
+        goto errors;
+    }
+    accumulator->generation = 0;
+    accumulator->channel_table = channel_table;
+    accumulator->channel_number = channel_number;
+    accumulator->group_total_table = group_total_table;
+    accumulator->group_number = group_number;
+    for (idx = 0; idx < channel_number; idx++) {
+        channel_table[idx].total_mwh_mvah = 0;
+        channel_table[idx].last_mwh_mvah = 0;
+        channel_table[idx].reset_count = 0;
+        channel_table[idx].group_index = UNA_ENERGY_GROUP_NONE;
+        channel_table[idx].initialized = 0;
+    }
+    for (idx = 0; idx < group_number; idx++) {
+        group_total_table[idx] = 0;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_set_group(UNA_energy_t* accumulator, uint32_t channel_index, uint8_t group_index) {
+    // Local variables.
+    UNA_ENERGY_status_t status = UNA_ENERGY_SUCCESS;
+    // Check parameters.
+    if (accumulator == NULL) {
+        status = UNA_ENERGY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (channel_index >= accumulator->channel_number) {
+        status = UNA_ENERGY_ERROR_CHANNEL_INDEX;
+        goto errors;
+    }
+    if ((group_index >= accumulator->group_number) && (group_index != UNA_ENERGY_GROUP_NONE)) {
+        status = UNA_ENERGY_ERROR_GROUP_INDEX;
+        goto errors;
+    }
+    accumulator->channel_table[channel_index].group_index = group_index;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_ingest_batch(UNA_energy_t* accumulator, uint32_t first_channel_index, const uint32_t* una_electrical_energy, uint32_t size) {
+    // Local variables.
+    UNA_ENERGY_status_t status = UNA_ENERGY_SUCCESS;
+    int32_t reading_chunk[UNA_ENERGY_DECODE_CHUNK_SIZE];
+    uint32_t chunk_size = 0;
+    uint32_t offset = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((accumulator == NULL) || (una_electrical_energy == NULL)) {
+        status = UNA_ENERGY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((first_channel_index >= accumulator->channel_number) || (size > (accumulator->channel_number - first_channel_index))) {
+        status = UNA_ENERGY_ERROR_CHANNEL_INDEX;
+        goto errors;
+    }
+    for (offset = 0; offset < size; offset += chunk_size) {
+        chunk_size = ((size - offset) < UNA_ENERGY_DECODE_CHUNK_SIZE) ? (size - offset) : UNA_ENERGY_DECODE_CHUNK_SIZE;
+        // Decode outside of the write section, so that readers are delayed as little as possible.
+        UNA_get_mwh_mvah_batch(&(una_electrical_energy[offset]), reading_chunk, chunk_size);
+        UNA_LOCKFREE_write_begin(&(accumulator->generation));
+        for (idx = 0; idx < chunk_size; idx++) {
+            _UNA_ENERGY_accumulate(accumulator, &(accumulator->channel_table[first_channel_index + offset + idx]), reading_chunk[idx], _UNA_ENERGY_get_step(una_electrical_energy[offset + idx]));
+        }
+        UNA_LOCKFREE_write_end(&(accumulator->generation));
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_read_channel(UNA_energy_t* accumulator, uint32_t channel_index, int64_t* total_mwh_mvah, uint32_t* reset_count) {
+    // Local variables.
+    UNA_ENERGY_status_t status = UNA_ENERGY_SUCCESS;
+    volatile UNA_energy_channel_t* channel = NULL;
+    uint32_t generation = 0;
+    int64_t total = 0;
+    uint32_t count = 0;
+    // Check parameters.
+    if ((accumulator == NULL) || (total_mwh_mvah == NULL)) {
+        status = UNA_ENERGY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (channel_index >= accumulator->channel_number) {
+        status = UNA_ENERGY_ERROR_CHANNEL_INDEX;
+        goto errors;
+    }
+    channel = &(accumulator->channel_table[channel_index]);
+    // Copy until a consistent snapshot is obtained.
+    do {
+        generation = UNA_LOCKFREE_read_begin(&(accumulator->generation));
+        total = channel->total_mwh_mvah;
+        count = channel->reset_count;
+    }
+    while (UNA_LOCKFREE_read_retry(&(accumulator->generation), generation) != 0);
+    (*total_mwh_mvah) = total;
+    if (reset_count != NULL) {
+        (*reset_count) = count;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_ENERGY_status_t UNA_ENERGY_snapshot_groups(UNA_energy_t* accumulator, int64_t* group_total_mwh_mvah, uint8_t group_number) {
+    // Local variables.
+    UNA_ENERGY_status_t status = UNA_ENERGY_SUCCESS;
+    volatile int64_t* group_total_table = NULL;
+    uint32_t generation = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((accumulator == NULL) || (group_total_mwh_mvah == NULL)) {
+        status = UNA_ENERGY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (group_number > accumulator->group_number) {
+        status = UNA_ENERGY_ERROR_GROUP_INDEX;
+        goto errors;
+    }
+    group_total_table = accumulator->group_total_table;
+    // Copy until a consistent snapshot is obtained.
+    do {
+        generation = UNA_LOCKFREE_read_begin(&(accumulator->generation));
+        for (idx = 0; idx < group_number; idx++) {
+            group_total_mwh_mvah[idx] = group_total_table[idx];
+        }
+    }
+    while (UNA_LOCKFREE_read_retry(&(accumulator->generation), generation) != 0);
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,153 @@
+/*
+ * una_field.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_field.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+#include "una_cache.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA FIELD local macros ***/
+
+#define UNA_FIELD_AGE_INFINITE  0xFFFFFFFF
+
+/*** UNA FIELD functions ***/
+
+/*******************************************************************/
+void UNA_FIELD_encode(const UNA_field_t* field, int32_t physical_data, uint32_t* reg_value, uint32_t* reg_mask) {
+    // Local variables.
+    uint32_t field_value = (uint32_t) physical_data;
+    // Check parameters.
+    if ((field == NULL) || (reg_value == NULL) || (reg_mask == NULL)) {
+        return;
+    }
+    if (field->convert != NULL) {
+        field_value = field->convert(physical_data);
+    }
+    (*reg_value) = ((*reg_value) & (~field->mask)) | ((field_value << field->offset) & field->mask);
+    (*reg_mask) |= field->mask;
+}
+
+/*******************************************************************/
+int32_t UNA_FIELD_decode(const UNA_field_t* field, uint32_t reg_value) {
+    // Local variables.
+    uint32_t field_value = 0;
+    // Check parameter.
+    if (field == NULL) {
+        return 0;
+    }
+    field_value = ((reg_value & field->mask) >> field->offset);
+    return ((field->get != NULL) ? field->get(field_value) : ((int32_t) field_value));
+}
+
+/*******************************************************************/
+UNA_FIELD_status_t UNA_FIELD_set(UNA_cache_t* shadow, UNA_node_address_t node_addr, const UNA_field_t* field, int32_t physical_data) {
+    // Local variables.
+    UNA_FIELD_status_t status = UNA_FIELD_SUCCESS;
+    UNA_CACHE_status_t cache_status = UNA_CACHE_SUCCESS;
+    uint32_t reg_value = 0;
+    uint32_t reg_mask = 0;
+    uint32_t shadow_value = 0;
+    uint32_t dirty_mask = 0;
+    // Check parameters.
+    if ((shadow == NULL) || (field == NULL)) {
+        status = UNA_FIELD_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_FIELD_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    UNA_FIELD_encode(field, physical_data, &reg_value, &reg_mask);
+    // Skip unchanged fields, either known from the node or already pending.
+    cache_status = UNA_CACHE_read(shadow, node_addr, field->reg_addr, UNA_FIELD_AGE_INFINITE, 0, &shadow_value, NULL);
+    if (cache_status != UNA_CACHE_SUCCESS) {
+        cache_status = UNA_CACHE_read_dirty(shadow, node_addr, field->reg_addr, &shadow_value, &dirty_mask);
+        if (cache_status != UNA_CACHE_SUCCESS) {
+            dirty_mask = 0;
+        }
+        reg_mask &= ~(dirty_mask & (~(shadow_value ^ reg_value)));
+    }
+    else if (((shadow_value ^ reg_value) & reg_mask) == 0) {
+        goto errors;
+    }
+    if (reg_mask == 0) {
+        goto errors;
+    }
+    cache_status = UNA_CACHE_write(shadow, node_addr, field->reg_addr, reg_value, reg_mask);
+    if (cache_status != UNA_CACHE_SUCCESS) {
+        status = UNA_FIELD_ERROR_SHADOW;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_FIELD_status_t UNA_FIELD_flush(UNA_cache_t* shadow, UNA_access_parameters_t* write_params, UNA_write_register_t write_register, UNA_access_status_t* write_status) {
+    // Local variables.
+    UNA_FIELD_status_t status = UNA_FIELD_SUCCESS;
+    UNA_CACHE_status_t cache_status = UNA_CACHE_SUCCESS;
+    uint32_t reg_value = 0;
+    uint32_t dirty_mask = 0;
+    // Check parameters.
+    if ((shadow == NULL) || (write_params == NULL) || (write_register == NULL) || (write_status == NULL)) {
+        status = UNA_FIELD_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    write_status->all = 0;
+    write_status->type = UNA_ACCESS_TYPE_WRITE;
+    // Nothing to write if no field is pending.
+    cache_status = UNA_CACHE_read_dirty(shadow, write_params->node_addr, write_params->reg_addr, &reg_value, &dirty_mask);
+    if ((cache_status != UNA_CACHE_SUCCESS) || (dirty_mask == 0)) {
+        goto errors;
+    }
+    // Single masked write for all pending fields.
+    write_register(write_params, reg_value, dirty_mask, write_status);
+    if (write_status->flags != 0) {
+        status = UNA_FIELD_ERROR_ACCESS;
+        goto errors;
+    }
+    UNA_CACHE_clear_dirty(shadow, write_params->node_addr, write_params->reg_addr, dirty_mask);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_FIELD_status_t UNA_FIELD_read(UNA_cache_t* shadow, UNA_access_parameters_t* read_params, const UNA_field_t* field, uint32_t max_age_ms, uint32_t now_ms, UNA_read_register_t read_register, int32_t* physical_data, UNA_access_status_t* read_status) {
+    // Local variables.
+    UNA_FIELD_status_t status = UNA_FIELD_SUCCESS;
+    UNA_CACHE_status_t cache_status = UNA_CACHE_SUCCESS;
+    UNA_access_parameters_t field_params;
+    uint32_t reg_value = 0;
+    // Check parameters.
+    if ((read_params == NULL) || (field == NULL) || (physical_data == NULL)) {
+        status = UNA_FIELD_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    field_params = (*read_params);
+    field_params.reg_addr = field->reg_addr;
+    cache_status = UNA_CACHE_read_register(shadow, &field_params, max_age_ms, now_ms, read_register, &reg_value, read_status);
+    if (cache_status == UNA_CACHE_ERROR_ACCESS) {
+        status = UNA_FIELD_ERROR_ACCESS;
+        goto errors;
+    }
+    if (cache_status != UNA_CACHE_SUCCESS) {
+        status = (cache_status == UNA_CACHE_ERROR_NULL_PARAMETER) ? UNA_FIELD_ERROR_NULL_PARAMETER : UNA_FIELD_ERROR_SHADOW;
+        goto errors;
+    }
+    (*physical_data) = UNA_FIELD_decode(field, reg_value);
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,300 @@
+/*
+ * una_frame.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_frame.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA FRAME local macros ***/
+
+#define UNA_FRAME_COMMAND_PREFIX_SIZE_BYTES     5
+#define UNA_FRAME_COMMAND_READ                  'R'
+#define UNA_FRAME_COMMAND_WRITE                 'W'
+#define UNA_FRAME_FIELD_SEPARATOR               ','
+
+#define UNA_FRAME_HEX_DIGIT_SIZE_BITS           4
+#define UNA_FRAME_HEX_DIGIT_MASK                0x0F
+
+#define UNA_FRAME_LINEAR_INDEX_MASK             0xFFFFFFFF
+
+/*** UNA FRAME local global variables ***/
+
+static const char_t UNA_FRAME_HEX_DIGIT[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+/*** UNA FRAME local functions ***/
+
+/*******************************************************************/
+static inline uint8_t _UNA_FRAME_get_hex_size(uint32_t value) {
+    // Leading zeros are not sent.
+    return ((value == 0) ? 1 : (uint8_t) ((MATH_U32_SIZE_BITS - __builtin_clz(value) + (UNA_FRAME_HEX_DIGIT_SIZE_BITS - 1)) / UNA_FRAME_HEX_DIGIT_SIZE_BITS));
+}
+
+/*******************************************************************/
+static inline uint32_t _UNA_FRAME_get_free_size(UNA_frame_buffer_t* frame_buffer, uint32_t index) {
+    // Linear buffer space is only released by a reset, whatever the consumer position.
+    if (frame_buffer->index_mask == UNA_FRAME_LINEAR_INDEX_MASK) {
+        return (frame_buffer->size - index);
+    }
+    return (frame_buffer->size - (index - __atomic_load_n(&(frame_buffer->tail), __ATOMIC_ACQUIRE)));
+}
+
+/*******************************************************************/
+static inline void _UNA_FRAME_put(UNA_frame_buffer_t* frame_buffer, uint32_t* index, uint8_t byte) {
+    frame_buffer->data[(*index) & (frame_buffer->index_mask)] = byte;
+    (*index)++;
+}
+
+/*******************************************************************/
+static inline void _UNA_FRAME_put_hex(UNA_frame_buffer_t* frame_buffer, uint32_t* index, uint32_t value, uint8_t hex_size) {
+    // Local variables.
+    uint8_t shift = (uint8_t) (hex_size * UNA_FRAME_HEX_DIGIT_SIZE_BITS);
+    // Most significant digit first.
+    while (shift > 0) {
+        shift = (uint8_t) (shift - UNA_FRAME_HEX_DIGIT_SIZE_BITS);
+        _UNA_FRAME_put(frame_buffer, index, (uint8_t) UNA_FRAME_HEX_DIGIT[(value >> shift) & UNA_FRAME_HEX_DIGIT_MASK]);
+    }
+}
+
+/*******************************************************************/
+static inline void _UNA_FRAME_put_header(UNA_frame_buffer_t* frame_buffer, uint32_t* index, UNA_node_address_t destination_addr, UNA_node_address_t source_addr) {
+    _UNA_FRAME_put(frame_buffer, index, (uint8_t) (destination_addr | UNA_FRAME_ADDRESS_MARKER));
+    _UNA_FRAME_put(frame_buffer, index, (uint8_t) source_addr);
+}
+
+/*******************************************************************/
+static inline void _UNA_FRAME_commit(UNA_frame_buffer_t* frame_buffer, uint32_t index) {
+    // Frame content is visible before the consumer can see the new head.
+    __atomic_store_n(&(frame_buffer->head), index, __ATOMIC_RELEASE);
+}
+
+/*******************************************************************/
+static UNA_FRAME_status_t _UNA_FRAME_check_access(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_access_type_t access_type) {
+    // Local variables.
+    UNA_FRAME_status_t status = UNA_FRAME_SUCCESS;
+    // Check parameters.
+    if ((frame_buffer == NULL) || (frame_buffer->data == NULL)) {
+        status = UNA_FRAME_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (source_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_FRAME_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    if ((access_type != UNA_ACCESS_TYPE_READ) && (access_type != UNA_ACCESS_TYPE_WRITE)) {
+        status = UNA_FRAME_ERROR_ACCESS_TYPE;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static UNA_FRAME_status_t _UNA_FRAME_put_access(UNA_frame_buffer_t* frame_buffer, uint32_t* index, UNA_node_address_t source_addr, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask) {
+    // Local variables.
+    UNA_FRAME_status_t status = UNA_FRAME_SUCCESS;
+    uint32_t frame_size = 0;
+    uint8_t reg_addr_size = 0;
+    uint8_t reg_value_size = 0;
+    uint8_t reg_mask_size = 0;
+    // Check parameters.
+    if (access_params == NULL) {
+        status = UNA_FRAME_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (access_params->node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_FRAME_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    // Compute exact frame size before writing anything.
+    reg_addr_size = _UNA_FRAME_get_hex_size(access_params->reg_addr);
+    frame_size = (uint32_t) (UNA_FRAME_HEADER_SIZE_BYTES + UNA_FRAME_COMMAND_PREFIX_SIZE_BYTES + reg_addr_size + 1);
+    if (access_type == UNA_ACCESS_TYPE_WRITE) {
+        reg_value_size = _UNA_FRAME_get_hex_size(reg_value);
+        reg_mask_size = _UNA_FRAME_get_hex_size(reg_mask);
+        frame_size += (uint32_t) (reg_value_size + reg_mask_size + 2);
+    }
+    if (frame_size > _UNA_FRAME_get_free_size(frame_buffer, (*index))) {
+        status = UNA_FRAME_ERROR_OVERFLOW;
+        goto errors;
+    }
+    // Write frame directly into the buffer, the caller commits it.
+    _UNA_FRAME_put_header(frame_buffer, index, access_params->node_addr, source_addr);
+    _UNA_FRAME_put(frame_buffer, index, 'A');
+    _UNA_FRAME_put(frame_buffer, index, 'T');
+    _UNA_FRAME_put(frame_buffer, index, '$');
+    _UNA_FRAME_put(frame_buffer, index, (access_type == UNA_ACCESS_TYPE_WRITE) ? UNA_FRAME_COMMAND_WRITE : UNA_FRAME_COMMAND_READ);
+    _UNA_FRAME_put(frame_buffer, index, '=');
+    _UNA_FRAME_put_hex(frame_buffer, index, access_params->reg_addr, reg_addr_size);
+    if (access_type == UNA_ACCESS_TYPE_WRITE) {
+        _UNA_FRAME_put(frame_buffer, index, UNA_FRAME_FIELD_SEPARATOR);
+        _UNA_FRAME_put_hex(frame_buffer, index, reg_value, reg_value_size);
+        _UNA_FRAME_put(frame_buffer, index, UNA_FRAME_FIELD_SEPARATOR);
+        _UNA_FRAME_put_hex(frame_buffer, index, reg_mask, reg_mask_size);
+    }
+    _UNA_FRAME_put(frame_buffer, index, UNA_FRAME_END_CHAR);
+errors:
+    return status;
+}
+
+/*** UNA FRAME functions ***/
+
+/*******************************************************************/
+UNA_FRAME_status_t UNA_FRAME_init_buffer(UNA_frame_buffer_t* frame_buffer, uint8_t* data, uint32_t size, UNA_frame_buffer_mode_t mode) {
+    // Local variables.
+    UNA_FRAME_status_t status = UNA_FRAME_SUCCESS;
+    // Check parameters.
+    if ((frame_buffer == NULL) || (data == NULL)) {
+        status = UNA_FRAME_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (size == 0) {
+        status = UNA_FRAME_ERROR_SIZE;
+        goto errors;
+    }
+    switch (mode) {
+    case UNA_FRAME_BUFFER_MODE_LINEAR:
+        frame_buffer->index_mask = UNA_FRAME_LINEAR_INDEX_MASK;
+        break;
+    case UNA_FRAME_BUFFER_MODE_RING:
+        // Free running indexes are wrapped with a mask.
+        if ((size & (size - 1)) != 0) {
+            status = UNA_FRAME_ERROR_SIZE;
+            goto errors;
+        }
+        frame_buffer->index_mask = (size - 1);
+        break;
+    default:
+        status = UNA_FRAME_ERROR_MODE;
+        goto errors;
+    }
+    frame_buffer->data = data;
+    frame_buffer->size = size;
+    UNA_FRAME_reset_buffer(frame_buffer);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void UNA_FRAME_reset_buffer(UNA_frame_buffer_t* frame_buffer) {
+    // Check parameters.
+    if (frame_buffer == NULL) {
+        return;
+    }
+    frame_buffer->head = 0;
+    frame_buffer->tail = 0;
+}
+
+/*******************************************************************/
+uint32_t UNA_FRAME_get_size(UNA_frame_buffer_t* frame_buffer) {
+    // Check parameters.
+    if (frame_buffer == NULL) {
+        return 0;
+    }
+    return (frame_buffer->head - __atomic_load_n(&(frame_buffer->tail), __ATOMIC_ACQUIRE));
+}
+
+/*******************************************************************/
+UNA_FRAME_status_t UNA_FRAME_write_access(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask) {
+    // Local variables.
+    UNA_FRAME_status_t status = UNA_FRAME_SUCCESS;
+    uint32_t index = 0;
+    // Check parameters.
+    status = _UNA_FRAME_check_access(frame_buffer, source_addr, access_type);
+    if (status != UNA_FRAME_SUCCESS) {
+        goto errors;
+    }
+    index = frame_buffer->head;
+    status = _UNA_FRAME_put_access(frame_buffer, &index, source_addr, access_type, access_params, reg_value, reg_mask);
+    if (status != UNA_FRAME_SUCCESS) {
+        goto errors;
+    }
+    _UNA_FRAME_commit(frame_buffer, index);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_FRAME_status_t UNA_FRAME_write_command(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_command_parameters_t* command_params) {
+    // Local variables.
+    UNA_FRAME_status_t status = UNA_FRAME_SUCCESS;
+    uint32_t index = 0;
+    uint32_t command_size = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((frame_buffer == NULL) || (frame_buffer->data == NULL) || (command_params == NULL) || (command_params->command == NULL)) {
+        status = UNA_FRAME_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((source_addr >= UNA_NODE_ADDRESS_LAST) || (command_params->node_addr >= UNA_NODE_ADDRESS_LAST)) {
+        status = UNA_FRAME_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    while (command_params->command[command_size] != '\0') {
+        command_size++;
+    }
+    if ((UNA_FRAME_HEADER_SIZE_BYTES + command_size + 1) > _UNA_FRAME_get_free_size(frame_buffer, frame_buffer->head)) {
+        status = UNA_FRAME_ERROR_OVERFLOW;
+        goto errors;
+    }
+    // Write frame directly into the buffer.
+    index = frame_buffer->head;
+    _UNA_FRAME_put_header(frame_buffer, &index, command_params->node_addr, source_addr);
+    for (idx = 0; idx < command_size; idx++) {
+        _UNA_FRAME_put(frame_buffer, &index, (uint8_t) command_params->command[idx]);
+    }
+    _UNA_FRAME_put(frame_buffer, &index, UNA_FRAME_END_CHAR);
+    _UNA_FRAME_commit(frame_buffer, index);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_FRAME_status_t UNA_FRAME_write_access_batch(UNA_frame_buffer_t* frame_buffer, UNA_node_address_t source_addr, UNA_access_type_t access_type, UNA_access_parameters_t* access_params_table, const uint32_t* reg_value_table, const uint32_t* reg_mask_table, uint32_t size, uint32_t* frame_count) {
+    // Local variables.
+    UNA_FRAME_status_t status = UNA_FRAME_SUCCESS;
+    uint32_t index = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((access_params_table == NULL) || (frame_count == NULL)) {
+        status = UNA_FRAME_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*frame_count) = 0;
+    status = _UNA_FRAME_check_access(frame_buffer, source_addr, access_type);
+    if (status != UNA_FRAME_SUCCESS) {
+        goto errors;
+    }
+    if ((access_type == UNA_ACCESS_TYPE_WRITE) && ((reg_value_table == NULL) || (reg_mask_table == NULL))) {
+        status = UNA_FRAME_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Frames are written back to back and committed at once, so that the batch is never partially sent.
+    index = frame_buffer->head;
+    for (idx = 0; idx < size; idx++) {
+        if (access_type == UNA_ACCESS_TYPE_WRITE) {
+            status = _UNA_FRAME_put_access(frame_buffer, &index, source_addr, access_type, &(access_params_table[idx]), reg_value_table[idx], reg_mask_table[idx]);
+        }
+        else {
+            status = _UNA_FRAME_put_access(frame_buffer, &index, source_addr, access_type, &(access_params_table[idx]), 0, 0);
+        }
+        if (status != UNA_FRAME_SUCCESS) {
+            goto errors;
+        }
+    }
+    _UNA_FRAME_commit(frame_buffer, index);
+    (*frame_count) = size;
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,91 @@
+/*
+ * una_lockfree.h
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __UNA_LOCKFREE_H__
+#define __UNA_LOCKFREE_H__
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA LOCKFREE macros ***/
+
+// Multiplicative hash of the (node address, register address) keys of the lock-free tables.
+#define UNA_LOCKFREE_HASH(key)  ((uint16_t) (((uint32_t) (key) * 40503UL) >> 4))
+
+/*** UNA LOCKFREE functions ***/
+
+/*!******************************************************************
+ * \fn void UNA_LOCKFREE_write_begin(volatile uint32_t* sequence)
+ * \brief Start a single writer update protected by a sequence number. An odd sequence number indicates a write in progress.
+ * \param[in]   sequence: Pointer to the sequence number of the protected data.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static inline void UNA_LOCKFREE_write_begin(volatile uint32_t* sequence) {
+    __atomic_store_n(sequence, ((*sequence) + 1), __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+/*!******************************************************************
+ * \fn void UNA_LOCKFREE_write_end(volatile uint32_t* sequence)
+ * \brief End a single writer update, or publish a new version: the data is visible before the new sequence number.
+ * \param[in]   sequence: Pointer to the sequence number of the protected data.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+static inline void UNA_LOCKFREE_write_end(volatile uint32_t* sequence) {
+    __atomic_store_n(sequence, ((*sequence) + 1), __ATOMIC_RELEASE);
+}
+
+/*!******************************************************************
+ * \fn uint32_t UNA_LOCKFREE_read_version(volatile uint32_t* sequence)
+ * \brief Read the current sequence number before copying the protected data.
+ * \param[in]   sequence: Pointer to the sequence number of the protected data.
+ * \param[out]  none
+ * \retval      Sequence number to give to UNA_LOCKFREE_read_retry().
+ *******************************************************************/
+static inline uint32_t UNA_LOCKFREE_read_version(volatile uint32_t* sequence) {
+    return __atomic_load_n(sequence, __ATOMIC_ACQUIRE);
+}
+
+/*!******************************************************************
+ * \fn uint32_t UNA_LOCKFREE_read_begin(volatile uint32_t* sequence)
+ * \brief Wait for the end of the write in progress, if any, before copying the protected data.
+ * \param[in]   sequence: Pointer to the sequence number of the protected data.
+ * \param[out]  none
+ * \retval      Even sequence number to give to UNA_LOCKFREE_read_retry().
+ *******************************************************************/
+static inline uint32_t UNA_LOCKFREE_read_begin(volatile uint32_t* sequence) {
+    // Local variables.
+    uint32_t version = 0;
+    do {
+        version = UNA_LOCKFREE_read_version(sequence);
+    }
+    while ((version & 0b1) != 0);
+    return version;
+}
+
+/*!******************************************************************
+ * \fn uint8_t UNA_LOCKFREE_read_retry(volatile uint32_t* sequence, uint32_t version)
+ * \brief Check if the protected data has been modified during the copy.
+ * \param[in]   sequence: Pointer to the sequence number of the protected data.
+ * \param[in]   version: Sequence number read before the copy.
+ * \param[out]  none
+ * \retval      1 if the copy must be done again, 0 otherwise.
+ *******************************************************************/
+static inline uint8_t UNA_LOCKFREE_read_retry(volatile uint32_t* sequence, uint32_t version) {
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return ((__atomic_load_n(sequence, __ATOMIC_RELAXED) != version) ? 1 : 0);
+}
+
+#endif /* UNA_LIB_DISABLE */
+
+#endif /* __UNA_LOCKFREE_H__ */
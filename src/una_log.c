@@ -0,0 +1,424 @@
+/*
+ * una_log.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_log.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA LOG local macros ***/
+
+#define UNA_LOG_BLOCK_MARKER                0x55
+#define UNA_LOG_RECORD_COUNT_MAX            0xFFFF
+#define UNA_LOG_PAYLOAD_SIZE_MAX_BYTES      0xFFFF
+
+#define UNA_LOG_HEADER_INDEX_MARKER         0
+#define UNA_LOG_HEADER_INDEX_RECORD_COUNT   1
+#define UNA_LOG_HEADER_INDEX_PAYLOAD_SIZE   3
+#define UNA_LOG_HEADER_INDEX_FIRST_TIME     5
+#define UNA_LOG_HEADER_INDEX_LAST_TIME      9
+
+#define UNA_LOG_VARINT_DATA_MASK            0x7F
+#define UNA_LOG_VARINT_CONTINUATION         0x80
+#define UNA_LOG_VARINT_SIZE_MAX_BYTES       5
+
+#define UNA_LOG_DECODE_CHUNK_SIZE           32
+
+/*** UNA LOG local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint16_t record_count;
+    uint16_t payload_size;
+    uint32_t first_timestamp_ms;
+    uint32_t last_timestamp_ms;
+} UNA_LOG_block_header_t;
+
+/*** UNA LOG local functions ***/
+
+/*******************************************************************/
+static void _UNA_LOG_write_le(uint8_t* buffer, uint32_t value, uint8_t size_bytes) {
+    // Local variables.
+    uint8_t idx = 0;
+    for (idx = 0; idx < size_bytes; idx++) {
+        buffer[idx] = (uint8_t) (value >> (idx << 3));
+    }
+}
+
+/*******************************************************************/
+static uint32_t _UNA_LOG_read_le(const uint8_t* buffer, uint8_t size_bytes) {
+    // Local variables.
+    uint32_t value = 0;
+    uint8_t idx = 0;
+    for (idx = 0; idx < size_bytes; idx++) {
+        value |= (((uint32_t) buffer[idx]) << (idx << 3));
+    }
+    return value;
+}
+
+/*******************************************************************/
+static uint32_t _UNA_LOG_write_varint(uint8_t* buffer, uint32_t value) {
+    // Local variables.
+    uint32_t size = 0;
+    // 7 bits per byte, most significant bit set when another byte follows.
+    while (value > UNA_LOG_VARINT_DATA_MASK) {
+        buffer[size++] = (uint8_t) ((value & UNA_LOG_VARINT_DATA_MASK) | UNA_LOG_VARINT_CONTINUATION);
+        value >>= 7;
+    }
+    buffer[size++] = (uint8_t) value;
+    return size;
+}
+
+/*******************************************************************/
+static UNA_LOG_status_t _UNA_LOG_read_varint(UNA_log_reader_t* reader, uint32_t* value) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    uint8_t byte = 0;
+    uint8_t idx = 0;
+    (*value) = 0;
+    for (idx = 0; idx < UNA_LOG_VARINT_SIZE_MAX_BYTES; idx++) {
+        if (reader->record_offset >= reader->payload_end) {
+            break;
+        }
+        byte = reader->data[reader->record_offset++];
+        (*value) |= (((uint32_t) (byte & UNA_LOG_VARINT_DATA_MASK)) << (7 * idx));
+        if ((byte & UNA_LOG_VARINT_CONTINUATION) == 0) {
+            goto errors;
+        }
+    }
+    status = UNA_LOG_ERROR_CORRUPTED_BLOCK;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static UNA_LOG_status_t _UNA_LOG_read_header(UNA_log_reader_t* reader, UNA_LOG_block_header_t* header) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    const uint8_t* block = &(reader->data[reader->block_offset]);
+    // Check header and payload bounds.
+    if (((reader->size_bytes - reader->block_offset) < UNA_LOG_BLOCK_HEADER_SIZE_BYTES) || (block[UNA_LOG_HEADER_INDEX_MARKER] != UNA_LOG_BLOCK_MARKER)) {
+        status = UNA_LOG_ERROR_CORRUPTED_BLOCK;
+        goto errors;
+    }
+    header->record_count = (uint16_t) _UNA_LOG_read_le(&(block[UNA_LOG_HEADER_INDEX_RECORD_COUNT]), 2);
+    header->payload_size = (uint16_t) _UNA_LOG_read_le(&(block[UNA_LOG_HEADER_INDEX_PAYLOAD_SIZE]), 2);
+    header->first_timestamp_ms = _UNA_LOG_read_le(&(block[UNA_LOG_HEADER_INDEX_FIRST_TIME]), 4);
+    header->last_timestamp_ms = _UNA_LOG_read_le(&(block[UNA_LOG_HEADER_INDEX_LAST_TIME]), 4);
+    if ((reader->size_bytes - reader->block_offset - UNA_LOG_BLOCK_HEADER_SIZE_BYTES) < header->payload_size) {
+        status = UNA_LOG_ERROR_CORRUPTED_BLOCK;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static void _UNA_LOG_enter_block(UNA_log_reader_t* reader, UNA_LOG_block_header_t* header) {
+    reader->record_offset = (reader->block_offset + UNA_LOG_BLOCK_HEADER_SIZE_BYTES);
+    reader->payload_end = (reader->record_offset + header->payload_size);
+    reader->record_index = 0;
+    reader->record_count = header->record_count;
+    reader->timestamp_ms = header->first_timestamp_ms;
+    // Next block.
+    reader->block_offset = reader->payload_end;
+}
+
+/*******************************************************************/
+static UNA_LOG_status_t _UNA_LOG_next(UNA_log_reader_t* reader, UNA_log_record_t* record, uint8_t* record_available) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    UNA_LOG_block_header_t header;
+    uint32_t delta_ms = 0;
+    (*record_available) = 0;
+    // Load next non-empty block.
+    while (reader->record_index >= reader->record_count) {
+        if (reader->block_offset >= reader->size_bytes) {
+            goto errors;
+        }
+        status = _UNA_LOG_read_header(reader, &header);
+        if (status != UNA_LOG_SUCCESS) {
+            goto errors;
+        }
+        _UNA_LOG_enter_block(reader, &header);
+    }
+    // Decode record.
+    if ((reader->payload_end - reader->record_offset) < 2) {
+        status = UNA_LOG_ERROR_CORRUPTED_BLOCK;
+        goto errors;
+    }
+    record->node_addr = (UNA_node_address_t) reader->data[reader->record_offset++];
+    record->reg_addr = reader->data[reader->record_offset++];
+    status = _UNA_LOG_read_varint(reader, &delta_ms);
+    if (status != UNA_LOG_SUCCESS) {
+        goto errors;
+    }
+    status = _UNA_LOG_read_varint(reader, &(record->reg_value));
+    if (status != UNA_LOG_SUCCESS) {
+        goto errors;
+    }
+    reader->timestamp_ms += delta_ms;
+    reader->record_index++;
+    record->timestamp_ms = reader->timestamp_ms;
+    (*record_available) = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static void _UNA_LOG_decode_chunk(UNA_get_physical_data_batch_t get_batch, const uint32_t* raw_chunk, int32_t* physical_data, uint32_t chunk_size) {
+    // Local variables.
+    uint32_t idx = 0;
+    if (get_batch != NULL) {
+        get_batch(raw_chunk, physical_data, chunk_size);
+        return;
+    }
+    for (idx = 0; idx < chunk_size; idx++) {
+        physical_data[idx] = (int32_t) raw_chunk[idx];
+    }
+}
+
+/*** UNA LOG functions ***/
+
+/*******************************************************************/
+UNA_LOG_status_t UNA_LOG_writer_init(UNA_log_writer_t* writer, uint8_t* block, uint32_t block_size_bytes, UNA_LOG_write_block_cb_t write_block_callback) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    // Check parameters.
+    if ((writer == NULL) || (block == NULL) || (write_block_callback == NULL)) {
+        status = UNA_LOG_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((block_size_bytes < UNA_LOG_BLOCK_SIZE_MIN_BYTES) || (block_size_bytes > (UNA_LOG_BLOCK_HEADER_SIZE_BYTES + UNA_LOG_PAYLOAD_SIZE_MAX_BYTES))) {
+        status = UNA_LOG_ERROR_SIZE;
+        goto errors;
+    }
+    writer->block = block;
+    writer->block_size_bytes = block_size_bytes;
+    writer->block_index = UNA_LOG_BLOCK_HEADER_SIZE_BYTES;
+    writer->record_count = 0;
+    writer->first_timestamp_ms = 0;
+    writer->last_timestamp_ms = 0;
+    writer->block_count = 0;
+    writer->write_block_callback = write_block_callback;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_LOG_status_t UNA_LOG_write(UNA_log_writer_t* writer, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t timestamp_ms, uint32_t reg_value) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    uint8_t* record = NULL;
+    // Check parameters.
+    if ((writer == NULL) || (writer->block == NULL)) {
+        status = UNA_LOG_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_LOG_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    // Last timestamp is kept across blocks, so that the blocks time ranges used by the reader never overlap.
+    if (((writer->record_count != 0) || (writer->block_count != 0)) && (timestamp_ms < writer->last_timestamp_ms)) {
+        status = UNA_LOG_ERROR_TIMESTAMP;
+        goto errors;
+    }
+    // Store current block if the record may not fit.
+    if (((writer->block_index + UNA_LOG_RECORD_SIZE_MAX_BYTES) > writer->block_size_bytes) || (writer->record_count >= UNA_LOG_RECORD_COUNT_MAX)) {
+        status = UNA_LOG_flush(writer);
+        if (status != UNA_LOG_SUCCESS) {
+            goto errors;
+        }
+    }
+    if (writer->record_count == 0) {
+        writer->first_timestamp_ms = timestamp_ms;
+        writer->last_timestamp_ms = timestamp_ms;
+    }
+    // Addresses, timestamp delta and raw value.
+    record = &(writer->block[writer->block_index]);
+    record[0] = (uint8_t) node_addr;
+    record[1] = reg_addr;
+    writer->block_index += 2;
+    writer->block_index += _UNA_LOG_write_varint(&(writer->block[writer->block_index]), (timestamp_ms - writer->last_timestamp_ms));
+    writer->block_index += _UNA_LOG_write_varint(&(writer->block[writer->block_index]), reg_value);
+    writer->last_timestamp_ms = timestamp_ms;
+    writer->record_count++;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_LOG_status_t UNA_LOG_flush(UNA_log_writer_t* writer) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    // Check parameter.
+    if ((writer == NULL) || (writer->block == NULL)) {
+        status = UNA_LOG_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (writer->record_count == 0) {
+        goto errors;
+    }
+    // Block header is the index used by the reader to skip complete blocks.
+    writer->block[UNA_LOG_HEADER_INDEX_MARKER] = UNA_LOG_BLOCK_MARKER;
+    _UNA_LOG_write_le(&(writer->block[UNA_LOG_HEADER_INDEX_RECORD_COUNT]), writer->record_count, 2);
+    _UNA_LOG_write_le(&(writer->block[UNA_LOG_HEADER_INDEX_PAYLOAD_SIZE]), (writer->block_index - UNA_LOG_BLOCK_HEADER_SIZE_BYTES), 2);
+    _UNA_LOG_write_le(&(writer->block[UNA_LOG_HEADER_INDEX_FIRST_TIME]), writer->first_timestamp_ms, 4);
+    _UNA_LOG_write_le(&(writer->block[UNA_LOG_HEADER_INDEX_LAST_TIME]), writer->last_timestamp_ms, 4);
+    writer->write_block_callback(writer->block, writer->block_index);
+    // Start new block.
+    writer->block_index = UNA_LOG_BLOCK_HEADER_SIZE_BYTES;
+    writer->record_count = 0;
+    writer->block_count++;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_LOG_status_t UNA_LOG_reader_init(UNA_log_reader_t* reader, const uint8_t* data, uint32_t size_bytes) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    // Check parameters.
+    if ((reader == NULL) || ((data == NULL) && (size_bytes != 0))) {
+        status = UNA_LOG_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    reader->data = data;
+    reader->size_bytes = size_bytes;
+    reader->block_offset = 0;
+    reader->record_offset = 0;
+    reader->payload_end = 0;
+    reader->record_index = 0;
+    reader->record_count = 0;
+    reader->timestamp_ms = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_LOG_status_t UNA_LOG_seek(UNA_log_reader_t* reader, uint32_t start_timestamp_ms) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    UNA_LOG_block_header_t header;
+    UNA_log_reader_t previous_state;
+    UNA_log_record_t record;
+    uint8_t record_available = 0;
+    // Restart from the beginning of the log.
+    status = UNA_LOG_reader_init(reader, (reader == NULL) ? NULL : reader->data, (reader == NULL) ? 0 : reader->size_bytes);
+    if (status != UNA_LOG_SUCCESS) {
+        goto errors;
+    }
+    // Skip complete blocks without decoding them.
+    while (reader->block_offset < reader->size_bytes) {
+        status = _UNA_LOG_read_header(reader, &header);
+        if (status != UNA_LOG_SUCCESS) {
+            goto errors;
+        }
+        if ((header.record_count != 0) && (header.last_timestamp_ms >= start_timestamp_ms)) {
+            _UNA_LOG_enter_block(reader, &header);
+            break;
+        }
+        reader->block_offset += (UNA_LOG_BLOCK_HEADER_SIZE_BYTES + header.payload_size);
+    }
+    // Skip older records of the first block.
+    while (reader->record_index < reader->record_count) {
+        previous_state = (*reader);
+        status = _UNA_LOG_next(reader, &record, &record_available);
+        if (status != UNA_LOG_SUCCESS) {
+            goto errors;
+        }
+        if (record.timestamp_ms >= start_timestamp_ms) {
+            (*reader) = previous_state;
+            break;
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_LOG_status_t UNA_LOG_read_records(UNA_log_reader_t* reader, uint32_t end_timestamp_ms, UNA_log_record_t* record_table, uint32_t record_number_max, uint32_t* record_number) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    UNA_log_reader_t previous_state;
+    uint8_t record_available = 0;
+    // Check parameters.
+    if ((reader == NULL) || (record_table == NULL) || (record_number == NULL)) {
+        status = UNA_LOG_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*record_number) = 0;
+    while ((*record_number) < record_number_max) {
+        previous_state = (*reader);
+        status = _UNA_LOG_next(reader, &(record_table[*record_number]), &record_available);
+        if ((status != UNA_LOG_SUCCESS) || (record_available == 0)) {
+            break;
+        }
+        // Keep the record for the next range if it is too recent.
+        if (record_table[*record_number].timestamp_ms > end_timestamp_ms) {
+            (*reader) = previous_state;
+            break;
+        }
+        (*record_number)++;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_LOG_status_t UNA_LOG_read_values(UNA_log_reader_t* reader, uint32_t end_timestamp_ms, UNA_node_address_t node_addr, uint16_t reg_addr, UNA_get_physical_data_batch_t get_batch, uint32_t* timestamp_table, int32_t* physical_data_table, uint32_t value_number_max, uint32_t* value_number) {
+    // Local variables.
+    UNA_LOG_status_t status = UNA_LOG_SUCCESS;
+    UNA_log_reader_t previous_state;
+    UNA_log_record_t record;
+    uint32_t raw_chunk[UNA_LOG_DECODE_CHUNK_SIZE];
+    uint32_t chunk_size = 0;
+    uint8_t record_available = 0;
+    // Check parameters.
+    if ((reader == NULL) || (physical_data_table == NULL) || (value_number == NULL)) {
+        status = UNA_LOG_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*value_number) = 0;
+    while (((*value_number) + chunk_size) < value_number_max) {
+        previous_state = (*reader);
+        status = _UNA_LOG_next(reader, &record, &record_available);
+        if ((status != UNA_LOG_SUCCESS) || (record_available == 0)) {
+            break;
+        }
+        if (record.timestamp_ms > end_timestamp_ms) {
+            (*reader) = previous_state;
+            break;
+        }
+        if ((record.node_addr != node_addr) || ((reg_addr != UNA_LOG_REGISTER_ADDRESS_ALL) && (record.reg_addr != reg_addr))) {
+            continue;
+        }
+        if (timestamp_table != NULL) {
+            timestamp_table[(*value_number) + chunk_size] = record.timestamp_ms;
+        }
+        raw_chunk[chunk_size++] = record.reg_value;
+        // Decode full chunks through the batch path.
+        if (chunk_size >= UNA_LOG_DECODE_CHUNK_SIZE) {
+            _UNA_LOG_decode_chunk(get_batch, raw_chunk, &(physical_data_table[*value_number]), chunk_size);
+            (*value_number) += chunk_size;
+            chunk_size = 0;
+        }
+    }
+    // Remaining values.
+    _UNA_LOG_decode_chunk(get_batch, raw_chunk, &(physical_data_table[*value_number]), chunk_size);
+    (*value_number) += chunk_size;
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,156 @@
+/*
+ * una_loopback.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_loopback.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA LOOPBACK local macros ***/
+
+#define UNA_LOOPBACK_PRESENCE_SIZE_WORDS    ((UNA_NODE_ADDRESS_LAST + MATH_U32_SIZE_BITS - 1) / MATH_U32_SIZE_BITS)
+
+/*** UNA LOOPBACK local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t* register_file;
+    uint16_t register_number;
+    uint32_t presence[UNA_LOOPBACK_PRESENCE_SIZE_WORDS];
+    uint32_t access_count;
+} UNA_LOOPBACK_context_t;
+
+/*** UNA LOOPBACK global variables ***/
+
+const UNA_transport_t UNA_LOOPBACK_TRANSPORT = {
+    &UNA_LOOPBACK_read_register,
+    &UNA_LOOPBACK_write_register
+};
+
+/*** UNA LOOPBACK local global variables ***/
+
+static UNA_LOOPBACK_context_t una_loopback_ctx = {
+    .register_file = NULL,
+    .register_number = 0,
+    .access_count = 0
+};
+
+/*** UNA LOOPBACK local functions ***/
+
+/*******************************************************************/
+static uint32_t* _UNA_LOOPBACK_get_register(UNA_access_parameters_t* access_params, UNA_access_status_t* access_status) {
+    // Local variables.
+    uint32_t* reg = NULL;
+    uint8_t node_addr = (uint8_t) access_params->node_addr;
+    una_loopback_ctx.access_count++;
+    // Absent nodes never reply.
+    if ((una_loopback_ctx.register_file == NULL) || (node_addr >= UNA_NODE_ADDRESS_LAST) || ((una_loopback_ctx.presence[node_addr / MATH_U32_SIZE_BITS] & (0b1UL << (node_addr % MATH_U32_SIZE_BITS))) == 0)) {
+        access_status->reply_timeout = 1;
+        goto errors;
+    }
+    // Unknown registers are rejected by the node.
+    if (access_params->reg_addr >= una_loopback_ctx.register_number) {
+        access_status->error_received = 1;
+        goto errors;
+    }
+    reg = &(una_loopback_ctx.register_file[(node_addr * una_loopback_ctx.register_number) + access_params->reg_addr]);
+errors:
+    return reg;
+}
+
+/*** UNA LOOPBACK functions ***/
+
+/*******************************************************************/
+UNA_LOOPBACK_status_t UNA_LOOPBACK_init(uint32_t* register_file, uint16_t register_number) {
+    // Local variables.
+    UNA_LOOPBACK_status_t status = UNA_LOOPBACK_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    if (register_file == NULL) {
+        status = UNA_LOOPBACK_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (register_number == 0) {
+        status = UNA_LOOPBACK_ERROR_SIZE;
+        goto errors;
+    }
+    // Init context.
+    una_loopback_ctx.register_file = register_file;
+    una_loopback_ctx.register_number = register_number;
+    una_loopback_ctx.access_count = 0;
+    for (idx = 0; idx < UNA_LOOPBACK_PRESENCE_SIZE_WORDS; idx++) {
+        una_loopback_ctx.presence[idx] = 0;
+    }
+    for (idx = 0; idx < ((uint32_t) UNA_NODE_ADDRESS_LAST * (uint32_t) register_number); idx++) {
+        register_file[idx] = 0;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_LOOPBACK_status_t UNA_LOOPBACK_set_node_presence(UNA_node_address_t node_addr, uint8_t present) {
+    // Local variables.
+    UNA_LOOPBACK_status_t status = UNA_LOOPBACK_SUCCESS;
+    // Check parameter.
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_LOOPBACK_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    if (present != 0) {
+        una_loopback_ctx.presence[node_addr / MATH_U32_SIZE_BITS] |= (0b1UL << (node_addr % MATH_U32_SIZE_BITS));
+    }
+    else {
+        una_loopback_ctx.presence[node_addr / MATH_U32_SIZE_BITS] &= ~(0b1UL << (node_addr % MATH_U32_SIZE_BITS));
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void UNA_LOOPBACK_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status) {
+    // Local variables.
+    uint32_t* reg = NULL;
+    // Check parameters.
+    if ((read_params == NULL) || (reg_value == NULL) || (read_status == NULL)) {
+        return;
+    }
+    read_status->all = 0;
+    read_status->type = UNA_ACCESS_TYPE_READ;
+    reg = _UNA_LOOPBACK_get_register(read_params, read_status);
+    if (reg != NULL) {
+        (*reg_value) = (*reg);
+    }
+}
+
+/*******************************************************************/
+void UNA_LOOPBACK_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status) {
+    // Local variables.
+    uint32_t* reg = NULL;
+    // Check parameters.
+    if ((write_params == NULL) || (write_status == NULL)) {
+        return;
+    }
+    write_status->all = 0;
+    write_status->type = UNA_ACCESS_TYPE_WRITE;
+    reg = _UNA_LOOPBACK_get_register(write_params, write_status);
+    if (reg != NULL) {
+        (*reg) = ((*reg) & (~reg_mask)) | (reg_value & reg_mask);
+    }
+}
+
+/*******************************************************************/
+uint32_t UNA_LOOPBACK_get_access_count(void) {
+    return (una_loopback_ctx.access_count);
+}
+
+#endif /* UNA_LIB_DISABLE */
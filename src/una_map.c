@@ -0,0 +1,115 @@
+/*
+ * una_map.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_map.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA MAP local macros ***/
+
+#define UNA_MAP_FIELD_MASK(size_bits)   ((uint32_t) ((((uint64_t) 0b1) << (size_bits)) - 1))
+
+/*** UNA MAP local global variables ***/
+
+// Registers shared by all boards.
+static const UNA_map_field_t UNA_MAP_COMMON_FIELD[] = {
+    { UNA_MAP_REGISTER_ADDRESS_NODE_ID, 0, 8, UNA_REGISTER_ACCESS_READ_ONLY, UNA_CODEC_RAW },
+    { UNA_MAP_REGISTER_ADDRESS_NODE_ID, 8, 8, UNA_REGISTER_ACCESS_READ_ONLY, UNA_CODEC_RAW },
+};
+
+static const UNA_register_map_t UNA_MAP_COMMON = {
+    (UNA_MAP_REGISTER_ADDRESS_NODE_ID + 1),
+    (sizeof(UNA_MAP_COMMON_FIELD) / sizeof(UNA_map_field_t)),
+    UNA_MAP_COMMON_FIELD
+};
+
+/*** UNA MAP global variables ***/
+
+const UNA_register_map_t* const UNA_REGISTER_MAP[UNA_BOARD_ID_LAST] = {
+    [0 ... (UNA_BOARD_ID_LAST - 1)] = &UNA_MAP_COMMON
+};
+
+/*** UNA MAP functions ***/
+
+/*******************************************************************/
+UNA_MAP_status_t UNA_MAP_decode(const UNA_register_map_t* map, const uint32_t* reg_image, uint8_t reg_number, int32_t* physical_data) {
+    // Local variables.
+    UNA_MAP_status_t status = UNA_MAP_SUCCESS;
+    const UNA_map_field_t* field = NULL;
+    uint32_t field_value = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((map == NULL) || (reg_image == NULL) || (physical_data == NULL)) {
+        status = UNA_MAP_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (reg_number < map->register_number) {
+        status = UNA_MAP_ERROR_REGISTER_NUMBER;
+        goto errors;
+    }
+    // Single pass over the fields, the codec switch is compiled as a jump table with direct calls.
+    for (idx = 0; idx < map->field_number; idx++) {
+        field = &(map->field_table[idx]);
+        field_value = ((reg_image[field->reg_addr] >> field->offset) & UNA_MAP_FIELD_MASK(field->size_bits));
+        switch (field->codec) {
+        case UNA_CODEC_SECONDS:
+            physical_data[idx] = UNA_get_seconds(field_value);
+            break;
+        case UNA_CODEC_YEAR:
+            physical_data[idx] = UNA_get_year(field_value);
+            break;
+        case UNA_CODEC_TENTH_DEGREES:
+            physical_data[idx] = UNA_get_tenth_degrees(field_value);
+            break;
+        case UNA_CODEC_MV:
+            physical_data[idx] = UNA_get_mv(field_value);
+            break;
+        case UNA_CODEC_UA:
+            physical_data[idx] = UNA_get_ua(field_value);
+            break;
+        case UNA_CODEC_MW_MVA:
+            physical_data[idx] = UNA_get_mw_mva(field_value);
+            break;
+        case UNA_CODEC_MWH_MVAH:
+            physical_data[idx] = UNA_get_mwh_mvah(field_value);
+            break;
+        case UNA_CODEC_POWER_FACTOR:
+            physical_data[idx] = UNA_get_power_factor(field_value);
+            break;
+        case UNA_CODEC_DBM:
+            physical_data[idx] = UNA_get_dbm(field_value);
+            break;
+        default:
+            physical_data[idx] = (int32_t) field_value;
+            break;
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_MAP_status_t UNA_MAP_decode_board(UNA_board_id_t board_id, const uint32_t* reg_image, uint8_t reg_number, int32_t* physical_data) {
+    // Local variables.
+    UNA_MAP_status_t status = UNA_MAP_SUCCESS;
+    // Check parameter.
+    if (board_id >= UNA_BOARD_ID_LAST) {
+        status = UNA_MAP_ERROR_BOARD_ID;
+        goto errors;
+    }
+    status = UNA_MAP_decode(UNA_REGISTER_MAP[board_id], reg_image, reg_number, physical_data);
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
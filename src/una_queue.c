@@ -0,0 +1,198 @@
+/*
+ * una_queue.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_queue.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA QUEUE local functions ***/
+
+/*******************************************************************/
+static void _UNA_QUEUE_sort_by_node(UNA_queue_t* queue) {
+    // Local variables.
+    UNA_transaction_t* transaction = NULL;
+    uint16_t idx = 0;
+    uint16_t position = 0;
+    // Stable insertion sort, which keeps the accesses order of each node and is linear when accesses are already grouped.
+    for (idx = 1; idx < queue->count; idx++) {
+        transaction = queue->transaction_table[idx];
+        position = idx;
+        while ((position > 0) && ((queue->transaction_table[position - 1]->access_params.node_addr) > (transaction->access_params.node_addr))) {
+            queue->transaction_table[position] = queue->transaction_table[position - 1];
+            position--;
+        }
+        queue->transaction_table[position] = transaction;
+    }
+}
+
+/*******************************************************************/
+static void _UNA_QUEUE_execute_read(UNA_queue_t* queue, UNA_transport_t* transport, uint16_t first_idx, uint16_t last_idx) {
+    // Local variables.
+    UNA_transaction_t* read = queue->transaction_table[first_idx];
+    UNA_transaction_t* transaction = NULL;
+    uint16_t idx = 0;
+    // Perform bus access.
+    read->status.all = 0;
+    read->status.type = UNA_ACCESS_TYPE_READ;
+    transport->read_register(&(read->access_params), &(read->reg_value), &(read->status));
+    queue->bus_access_count++;
+    // Share result with the next reads of the same register, until it is written.
+    for (idx = (first_idx + 1); idx <= last_idx; idx++) {
+        transaction = queue->transaction_table[idx];
+        if ((transaction == NULL) || (transaction->access_params.reg_addr != read->access_params.reg_addr)) {
+            continue;
+        }
+        if (transaction->type == UNA_ACCESS_TYPE_WRITE) {
+            break;
+        }
+        transaction->reg_value = read->reg_value;
+        transaction->status = read->status;
+        queue->transaction_table[idx] = NULL;
+    }
+}
+
+/*******************************************************************/
+static void _UNA_QUEUE_execute_write(UNA_queue_t* queue, UNA_transport_t* transport, uint16_t first_idx, uint16_t last_idx) {
+    // Local variables.
+    UNA_transaction_t* write = queue->transaction_table[first_idx];
+    UNA_transaction_t* transaction = NULL;
+    uint32_t reg_value = (write->reg_value & write->reg_mask);
+    uint32_t reg_mask = write->reg_mask;
+    uint16_t merge_idx = first_idx;
+    uint16_t idx = 0;
+    // Merge the next writes of the same register, until it is read.
+    for (idx = (first_idx + 1); idx <= last_idx; idx++) {
+        transaction = queue->transaction_table[idx];
+        if ((transaction == NULL) || (transaction->access_params.reg_addr != write->access_params.reg_addr)) {
+            continue;
+        }
+        if (transaction->type == UNA_ACCESS_TYPE_READ) {
+            break;
+        }
+        reg_value = (reg_value & (~transaction->reg_mask)) | (transaction->reg_value & transaction->reg_mask);
+        reg_mask |= transaction->reg_mask;
+        merge_idx = idx;
+    }
+    // Perform bus access.
+    write->status.all = 0;
+    write->status.type = UNA_ACCESS_TYPE_WRITE;
+    transport->write_register(&(write->access_params), reg_value, reg_mask, &(write->status));
+    queue->bus_access_count++;
+    // Report status to merged writes.
+    for (idx = (first_idx + 1); idx <= merge_idx; idx++) {
+        transaction = queue->transaction_table[idx];
+        if ((transaction == NULL) || (transaction->access_params.reg_addr != write->access_params.reg_addr)) {
+            continue;
+        }
+        transaction->status = write->status;
+        queue->transaction_table[idx] = NULL;
+    }
+}
+
+/*** UNA QUEUE functions ***/
+
+/*******************************************************************/
+UNA_QUEUE_status_t UNA_QUEUE_init(UNA_queue_t* queue, UNA_transaction_t** transaction_table, uint16_t size) {
+    // Local variables.
+    UNA_QUEUE_status_t status = UNA_QUEUE_SUCCESS;
+    // Check parameters.
+    if ((queue == NULL) || (transaction_table == NULL)) {
+        status = UNA_QUEUE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (size == 0) {
+        status = UNA_QUEUE_ERROR_SIZE;
+        goto errors;
+    }
+    queue->transaction_table = transaction_table;
+    queue->size = size;
+    queue->count = 0;
+    queue->bus_access_count = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_QUEUE_status_t UNA_QUEUE_add(UNA_queue_t* queue, UNA_transaction_t* transaction_list, uint16_t transaction_count) {
+    // Local variables.
+    UNA_QUEUE_status_t status = UNA_QUEUE_SUCCESS;
+    uint16_t idx = 0;
+    // Check parameters.
+    if ((queue == NULL) || (transaction_list == NULL)) {
+        status = UNA_QUEUE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((queue->count + transaction_count) > queue->size) {
+        status = UNA_QUEUE_ERROR_FULL;
+        goto errors;
+    }
+    for (idx = 0; idx < transaction_count; idx++) {
+        if ((transaction_list[idx].type != UNA_ACCESS_TYPE_READ) && (transaction_list[idx].type != UNA_ACCESS_TYPE_WRITE)) {
+            status = UNA_QUEUE_ERROR_ACCESS_TYPE;
+            goto errors;
+        }
+    }
+    for (idx = 0; idx < transaction_count; idx++) {
+        queue->transaction_table[queue->count++] = &(transaction_list[idx]);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_QUEUE_status_t UNA_QUEUE_execute(UNA_queue_t* queue, UNA_transport_t* transport) {
+    // Local variables.
+    UNA_QUEUE_status_t status = UNA_QUEUE_SUCCESS;
+    UNA_transaction_t* transaction = NULL;
+    uint16_t first_idx = 0;
+    uint16_t last_idx = 0;
+    uint16_t idx = 0;
+    // Check parameters.
+    if ((queue == NULL) || (transport == NULL)) {
+        status = UNA_QUEUE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((transport->read_register == NULL) || (transport->write_register == NULL)) {
+        status = UNA_QUEUE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    queue->bus_access_count = 0;
+    _UNA_QUEUE_sort_by_node(queue);
+    // Process each node group.
+    while (first_idx < queue->count) {
+        last_idx = first_idx;
+        while (((last_idx + 1) < queue->count) && (queue->transaction_table[last_idx + 1]->access_params.node_addr == queue->transaction_table[first_idx]->access_params.node_addr)) {
+            last_idx++;
+        }
+        for (idx = first_idx; idx <= last_idx; idx++) {
+            transaction = queue->transaction_table[idx];
+            // Skip accesses already completed by a previous read or merged write.
+            if (transaction == NULL) {
+                continue;
+            }
+            if (transaction->type == UNA_ACCESS_TYPE_READ) {
+                _UNA_QUEUE_execute_read(queue, transport, idx, last_idx);
+            }
+            else {
+                _UNA_QUEUE_execute_write(queue, transport, idx, last_idx);
+            }
+            queue->transaction_table[idx] = NULL;
+        }
+        first_idx = (last_idx + 1);
+    }
+    queue->count = 0;
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
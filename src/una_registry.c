@@ -0,0 +1,280 @@
+/*
+ * una_registry.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_registry.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA REGISTRY local macros ***/
+
+#define UNA_REGISTRY_PRESENCE_WORD(node_addr)   ((node_addr) / MATH_U32_SIZE_BITS)
+#define UNA_REGISTRY_PRESENCE_BIT(node_addr)    (0b1UL << ((node_addr) % MATH_U32_SIZE_BITS))
+
+/*** UNA REGISTRY local functions ***/
+
+/*******************************************************************/
+static inline uint8_t _UNA_REGISTRY_is_present(UNA_registry_t* registry, uint8_t node_addr) {
+    return (((registry->presence[UNA_REGISTRY_PRESENCE_WORD(node_addr)] & UNA_REGISTRY_PRESENCE_BIT(node_addr)) != 0) ? 1 : 0);
+}
+
+/*******************************************************************/
+static void _UNA_REGISTRY_link_board(UNA_registry_t* registry, uint8_t node_addr, uint8_t board_id) {
+    // Insert node at the head of the board chain.
+    registry->board_next_address[node_addr] = registry->board_head_address[board_id];
+    registry->board_head_address[board_id] = node_addr;
+    registry->board_count[board_id]++;
+}
+
+/*******************************************************************/
+static void _UNA_REGISTRY_unlink_board(UNA_registry_t* registry, uint8_t node_addr, uint8_t board_id) {
+    // Local variables.
+    uint8_t* link = &(registry->board_head_address[board_id]);
+    // Search node in the board chain, which length is bounded by the board address range.
+    while ((*link) != UNA_NODE_ADDRESS_ERROR) {
+        if ((*link) == node_addr) {
+            (*link) = registry->board_next_address[node_addr];
+            registry->board_count[board_id]--;
+            break;
+        }
+        link = &(registry->board_next_address[*link]);
+    }
+}
+
+/*** UNA REGISTRY functions ***/
+
+/*******************************************************************/
+void UNA_REGISTRY_reset(UNA_registry_t* registry) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Check parameter.
+    if (registry == NULL) {
+        return;
+    }
+    // Only the presence bitmap and the board chains heads are cleared, other arrays are never read without them.
+    for (idx = 0; idx < UNA_REGISTRY_PRESENCE_SIZE_WORDS; idx++) {
+        registry->presence[idx] = 0;
+    }
+    for (idx = 0; idx < UNA_BOARD_ID_LAST; idx++) {
+        registry->board_head_address[idx] = UNA_NODE_ADDRESS_ERROR;
+        registry->board_count[idx] = 0;
+    }
+    registry->count = 0;
+}
+
+/*******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_add_node(UNA_registry_t* registry, UNA_node_t* node) {
+    // Local variables.
+    UNA_REGISTRY_status_t status = UNA_REGISTRY_SUCCESS;
+    UNA_packed_node_t* packed_node = NULL;
+    // Check parameters.
+    if ((registry == NULL) || (node == NULL)) {
+        status = UNA_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node->address >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_REGISTRY_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    if (node->board_id >= UNA_BOARD_ID_LAST) {
+        status = UNA_REGISTRY_ERROR_BOARD_ID;
+        goto errors;
+    }
+    // Check if node is already present.
+    if (_UNA_REGISTRY_is_present(registry, (uint8_t) node->address) != 0) {
+        packed_node = &(registry->node[registry->slot[node->address]]);
+        // Move node to its new board chain.
+        if (packed_node->board_id != ((uint8_t) node->board_id)) {
+            _UNA_REGISTRY_unlink_board(registry, packed_node->address, packed_node->board_id);
+            _UNA_REGISTRY_link_board(registry, packed_node->address, (uint8_t) node->board_id);
+            packed_node->board_id = (uint8_t) node->board_id;
+        }
+    }
+    else {
+        // Append node.
+        packed_node = &(registry->node[registry->count]);
+        packed_node->address = (uint8_t) node->address;
+        packed_node->board_id = (uint8_t) node->board_id;
+        registry->slot[node->address] = registry->count;
+        registry->presence[UNA_REGISTRY_PRESENCE_WORD(node->address)] |= UNA_REGISTRY_PRESENCE_BIT(node->address);
+        _UNA_REGISTRY_link_board(registry, packed_node->address, packed_node->board_id);
+        registry->count++;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_remove_node(UNA_registry_t* registry, UNA_node_address_t node_addr) {
+    // Local variables.
+    UNA_REGISTRY_status_t status = UNA_REGISTRY_SUCCESS;
+    uint8_t slot = 0;
+    UNA_packed_node_t* last_node = NULL;
+    // Check parameters.
+    if (registry == NULL) {
+        status = UNA_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_REGISTRY_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    if (_UNA_REGISTRY_is_present(registry, (uint8_t) node_addr) == 0) {
+        status = UNA_REGISTRY_ERROR_NODE_NOT_FOUND;
+        goto errors;
+    }
+    slot = registry->slot[node_addr];
+    _UNA_REGISTRY_unlink_board(registry, (uint8_t) node_addr, registry->node[slot].board_id);
+    registry->presence[UNA_REGISTRY_PRESENCE_WORD(node_addr)] &= ~UNA_REGISTRY_PRESENCE_BIT(node_addr);
+    // Move last node to the free slot to keep the nodes array contiguous.
+    registry->count--;
+    last_node = &(registry->node[registry->count]);
+    registry->node[slot] = (*last_node);
+    registry->slot[last_node->address] = slot;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_get_node(UNA_registry_t* registry, UNA_node_address_t node_addr, UNA_node_t* node) {
+    // Local variables.
+    UNA_REGISTRY_status_t status = UNA_REGISTRY_SUCCESS;
+    // Check parameters.
+    if ((registry == NULL) || (node == NULL)) {
+        status = UNA_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_REGISTRY_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    if (_UNA_REGISTRY_is_present(registry, (uint8_t) node_addr) == 0) {
+        status = UNA_REGISTRY_ERROR_NODE_NOT_FOUND;
+        goto errors;
+    }
+    node->address = node_addr;
+    node->board_id = (UNA_board_id_t) registry->node[registry->slot[node_addr]].board_id;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_get_node_by_index(UNA_registry_t* registry, uint8_t index, UNA_node_t* node) {
+    // Local variables.
+    UNA_REGISTRY_status_t status = UNA_REGISTRY_SUCCESS;
+    // Check parameters.
+    if ((registry == NULL) || (node == NULL)) {
+        status = UNA_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (index >= registry->count) {
+        status = UNA_REGISTRY_ERROR_INDEX;
+        goto errors;
+    }
+    node->address = (UNA_node_address_t) registry->node[index].address;
+    node->board_id = (UNA_board_id_t) registry->node[index].board_id;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_get_board_nodes(UNA_registry_t* registry, UNA_board_id_t board_id, UNA_node_address_t* node_addr_list, uint8_t node_addr_list_size, uint8_t* node_count) {
+    // Local variables.
+    UNA_REGISTRY_status_t status = UNA_REGISTRY_SUCCESS;
+    uint8_t node_addr = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((registry == NULL) || (node_addr_list == NULL) || (node_count == NULL)) {
+        status = UNA_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (board_id >= UNA_BOARD_ID_LAST) {
+        status = UNA_REGISTRY_ERROR_BOARD_ID;
+        goto errors;
+    }
+    // Walk board chain.
+    node_addr = registry->board_head_address[board_id];
+    while ((node_addr != UNA_NODE_ADDRESS_ERROR) && (idx < node_addr_list_size)) {
+        node_addr_list[idx++] = (UNA_node_address_t) node_addr;
+        node_addr = registry->board_next_address[node_addr];
+    }
+    (*node_count) = registry->board_count[board_id];
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_import_node_list(UNA_registry_t* registry, UNA_node_list_t* node_list) {
+    // Local variables.
+    UNA_REGISTRY_status_t status = UNA_REGISTRY_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((registry == NULL) || (node_list == NULL)) {
+        status = UNA_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_list->count > UNA_NODE_ADDRESS_LAST) {
+        status = UNA_REGISTRY_ERROR_INDEX;
+        goto errors;
+    }
+    // Validate the whole list first, so that the registry is left unchanged on error.
+    for (idx = 0; idx < node_list->count; idx++) {
+        if (node_list->list[idx].address >= UNA_NODE_ADDRESS_LAST) {
+            status = UNA_REGISTRY_ERROR_NODE_ADDRESS;
+            goto errors;
+        }
+        if (node_list->list[idx].board_id >= UNA_BOARD_ID_LAST) {
+            status = UNA_REGISTRY_ERROR_BOARD_ID;
+            goto errors;
+        }
+    }
+    UNA_REGISTRY_reset(registry);
+    for (idx = 0; idx < node_list->count; idx++) {
+        status = UNA_REGISTRY_add_node(registry, &(node_list->list[idx]));
+        if (status != UNA_REGISTRY_SUCCESS) {
+            goto errors;
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_REGISTRY_status_t UNA_REGISTRY_export_node_list(UNA_registry_t* registry, UNA_node_list_t* node_list) {
+    // Local variables.
+    UNA_REGISTRY_status_t status = UNA_REGISTRY_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((registry == NULL) || (node_list == NULL)) {
+        status = UNA_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    UNA_reset_node_list(node_list);
+    for (idx = 0; idx < registry->count; idx++) {
+        node_list->list[idx].address = (UNA_node_address_t) registry->node[idx].address;
+        node_list->list[idx].board_id = (UNA_board_id_t) registry->node[idx].board_id;
+    }
+    node_list->count = registry->count;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+uint8_t UNA_REGISTRY_is_node_present(UNA_registry_t* registry, UNA_node_address_t node_addr) {
+    // Check parameters.
+    if ((registry == NULL) || (node_addr >= UNA_NODE_ADDRESS_LAST)) {
+        return 0;
+    }
+    return _UNA_REGISTRY_is_present(registry, (uint8_t) node_addr);
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,329 @@
+/*
+ * una_reply.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_reply.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+#include "una_frame.h"
+#include "una_trace.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA REPLY local macros ***/
+
+#define UNA_REPLY_VALUE_SIZE_MAX_DIGITS     8
+#define UNA_REPLY_HEX_DIGIT_SIZE_BITS       4
+
+#define UNA_REPLY_KEYWORD_ERROR             "ERROR"
+#define UNA_REPLY_KEYWORD_ERROR_SIZE        5
+
+#define UNA_REPLY_WORD_LOW_BITS             (((UNA_REPLY_word_t) (~((UNA_REPLY_word_t) 0))) / 0xFF)
+#define UNA_REPLY_WORD_HIGH_BITS            (UNA_REPLY_WORD_LOW_BITS * UNA_FRAME_ADDRESS_MARKER)
+#define UNA_REPLY_WORD_END_CHAR             (UNA_REPLY_WORD_LOW_BITS * UNA_FRAME_END_CHAR)
+
+/*** UNA REPLY local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    UNA_REPLY_STATE_IDLE = 0,
+    UNA_REPLY_STATE_SKIP,
+    UNA_REPLY_STATE_SOURCE,
+    UNA_REPLY_STATE_PAYLOAD,
+    UNA_REPLY_STATE_OK,
+    UNA_REPLY_STATE_OK_END,
+    UNA_REPLY_STATE_VALUE,
+    UNA_REPLY_STATE_ERROR,
+    UNA_REPLY_STATE_DISCARD,
+    UNA_REPLY_STATE_COMPLETE,
+    UNA_REPLY_STATE_LAST
+} UNA_REPLY_state_t;
+
+/*******************************************************************/
+typedef unsigned long UNA_REPLY_word_t;
+
+/*** UNA REPLY local functions ***/
+
+/*******************************************************************/
+static inline uint8_t _UNA_REPLY_get_hex_digit(uint8_t byte, uint8_t* digit) {
+    // Local variables.
+    uint8_t lower_case = (uint8_t) (byte | 0x20);
+    // Decode digit.
+    if ((byte >= '0') && (byte <= '9')) {
+        (*digit) = (uint8_t) (byte - '0');
+        return 1;
+    }
+    if ((lower_case >= 'a') && (lower_case <= 'f')) {
+        (*digit) = (uint8_t) (lower_case - 'a' + 10);
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static inline UNA_REPLY_word_t _UNA_REPLY_has_zero_byte(UNA_REPLY_word_t word) {
+    return ((word - UNA_REPLY_WORD_LOW_BITS) & (~word) & UNA_REPLY_WORD_HIGH_BITS);
+}
+
+/*******************************************************************/
+static void _UNA_REPLY_start_frame(UNA_reply_parser_t* parser, uint8_t byte) {
+    // Only the frames sent to the master can be the reply.
+    if ((byte & (~UNA_FRAME_ADDRESS_MARKER)) == UNA_NODE_ADDRESS_MASTER) {
+        UNA_TRACE_START(parser->trace_timestamp);
+        parser->state = UNA_REPLY_STATE_SOURCE;
+    }
+    else {
+        parser->state = UNA_REPLY_STATE_SKIP;
+    }
+}
+
+/*******************************************************************/
+static uint8_t _UNA_REPLY_end(UNA_reply_parser_t* parser) {
+    UNA_TRACE_STOP(UNA_TRACE_STAGE_PARSE, parser->node_addr, parser->trace_timestamp);
+    parser->state = UNA_REPLY_STATE_COMPLETE;
+    return 1;
+}
+
+/*******************************************************************/
+static void _UNA_REPLY_set_parser_error(UNA_reply_parser_t* parser) {
+    // Flag is visible immediately, the end of the frame is then ignored.
+    parser->access_status.parser_error = 1;
+    parser->state = UNA_REPLY_STATE_DISCARD;
+}
+
+/*******************************************************************/
+static uint8_t _UNA_REPLY_step(UNA_reply_parser_t* parser, uint8_t byte) {
+    // Local variables.
+    uint8_t digit = 0;
+    // An address byte in the payload means that the reply has been truncated.
+    if ((parser->state >= UNA_REPLY_STATE_PAYLOAD) && (parser->state <= UNA_REPLY_STATE_DISCARD) && ((byte & UNA_FRAME_ADDRESS_MARKER) != 0)) {
+        parser->access_status.parser_error = 1;
+        return _UNA_REPLY_end(parser);
+    }
+    switch (parser->state) {
+    case UNA_REPLY_STATE_IDLE:
+        if ((byte & UNA_FRAME_ADDRESS_MARKER) != 0) {
+            _UNA_REPLY_start_frame(parser, byte);
+        }
+        break;
+    case UNA_REPLY_STATE_SKIP:
+        if ((byte & UNA_FRAME_ADDRESS_MARKER) != 0) {
+            _UNA_REPLY_start_frame(parser, byte);
+        }
+        else if (byte == UNA_FRAME_END_CHAR) {
+            parser->state = UNA_REPLY_STATE_IDLE;
+        }
+        break;
+    case UNA_REPLY_STATE_SOURCE:
+        if ((byte & UNA_FRAME_ADDRESS_MARKER) != 0) {
+            _UNA_REPLY_start_frame(parser, byte);
+        }
+        else {
+            // Late replies of other nodes are ignored.
+            parser->state = (byte == parser->node_addr) ? UNA_REPLY_STATE_PAYLOAD : UNA_REPLY_STATE_SKIP;
+        }
+        break;
+    case UNA_REPLY_STATE_PAYLOAD:
+        if (byte == 'O') {
+            parser->state = UNA_REPLY_STATE_OK;
+        }
+        else if (_UNA_REPLY_get_hex_digit(byte, &digit) != 0) {
+            parser->reg_value = digit;
+            parser->index = 1;
+            parser->state = UNA_REPLY_STATE_VALUE;
+        }
+        else if (byte == UNA_FRAME_END_CHAR) {
+            parser->access_status.parser_error = 1;
+            return _UNA_REPLY_end(parser);
+        }
+        else {
+            _UNA_REPLY_set_parser_error(parser);
+        }
+        break;
+    case UNA_REPLY_STATE_OK:
+        if (byte == 'K') {
+            parser->state = UNA_REPLY_STATE_OK_END;
+        }
+        else {
+            _UNA_REPLY_set_parser_error(parser);
+        }
+        break;
+    case UNA_REPLY_STATE_OK_END:
+        if (byte == UNA_FRAME_END_CHAR) {
+            if (parser->reply_type != UNA_REPLY_TYPE_OK) {
+                parser->access_status.parser_error = 1;
+            }
+            return _UNA_REPLY_end(parser);
+        }
+        _UNA_REPLY_set_parser_error(parser);
+        break;
+    case UNA_REPLY_STATE_VALUE:
+        if (byte == UNA_FRAME_END_CHAR) {
+            if (parser->reply_type != UNA_REPLY_TYPE_VALUE) {
+                parser->access_status.parser_error = 1;
+            }
+            return _UNA_REPLY_end(parser);
+        }
+        // The first character of an error reply is also a hexadecimal digit.
+        if ((byte == UNA_REPLY_KEYWORD_ERROR[1]) && (parser->index == 1) && (parser->reg_value == 0xE)) {
+            parser->reg_value = 0;
+            parser->index = 2;
+            parser->state = UNA_REPLY_STATE_ERROR;
+        }
+        else if ((_UNA_REPLY_get_hex_digit(byte, &digit) != 0) && (parser->index < UNA_REPLY_VALUE_SIZE_MAX_DIGITS)) {
+            parser->reg_value = ((parser->reg_value << UNA_REPLY_HEX_DIGIT_SIZE_BITS) | digit);
+            parser->index++;
+        }
+        else {
+            _UNA_REPLY_set_parser_error(parser);
+        }
+        break;
+    case UNA_REPLY_STATE_ERROR:
+        if (byte != (uint8_t) UNA_REPLY_KEYWORD_ERROR[parser->index]) {
+            _UNA_REPLY_set_parser_error(parser);
+            break;
+        }
+        parser->index++;
+        if (parser->index >= UNA_REPLY_KEYWORD_ERROR_SIZE) {
+            // Error details are not decoded.
+            parser->access_status.error_received = 1;
+            parser->state = UNA_REPLY_STATE_DISCARD;
+        }
+        break;
+    case UNA_REPLY_STATE_DISCARD:
+        if (byte == UNA_FRAME_END_CHAR) {
+            return _UNA_REPLY_end(parser);
+        }
+        break;
+    case UNA_REPLY_STATE_COMPLETE:
+        return 1;
+    default:
+        _UNA_REPLY_set_parser_error(parser);
+        break;
+    }
+    return 0;
+}
+
+/*** UNA REPLY functions ***/
+
+/*******************************************************************/
+UNA_REPLY_status_t UNA_REPLY_start(UNA_reply_parser_t* parser, UNA_access_type_t access_type, UNA_access_parameters_t* access_params) {
+    // Local variables.
+    UNA_REPLY_status_t status = UNA_REPLY_SUCCESS;
+    // Check parameters.
+    if ((parser == NULL) || (access_params == NULL)) {
+        status = UNA_REPLY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((access_params->node_addr == UNA_NODE_ADDRESS_MASTER) || (access_params->node_addr >= UNA_NODE_ADDRESS_LAST)) {
+        status = UNA_REPLY_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    if ((access_type != UNA_ACCESS_TYPE_READ) && (access_type != UNA_ACCESS_TYPE_WRITE)) {
+        status = UNA_REPLY_ERROR_ACCESS_TYPE;
+        goto errors;
+    }
+    if (access_params->reply_params.type >= UNA_REPLY_TYPE_LAST) {
+        status = UNA_REPLY_ERROR_REPLY_TYPE;
+        goto errors;
+    }
+    parser->reg_value = 0;
+    parser->access_status.all = 0;
+    parser->access_status.type = access_type;
+    parser->node_addr = access_params->node_addr;
+    parser->reply_type = access_params->reply_params.type;
+    parser->index = 0;
+    parser->state = (parser->reply_type == UNA_REPLY_TYPE_NONE) ? UNA_REPLY_STATE_COMPLETE : UNA_REPLY_STATE_IDLE;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+uint8_t UNA_REPLY_parse_byte(UNA_reply_parser_t* parser, uint8_t byte) {
+    // Check parameters.
+    if (parser == NULL) {
+        return 0;
+    }
+    return _UNA_REPLY_step(parser, byte);
+}
+
+/*******************************************************************/
+uint32_t UNA_REPLY_parse_buffer(UNA_reply_parser_t* parser, uint8_t* data, uint32_t size) {
+    // Local variables.
+    UNA_REPLY_word_t word = 0;
+    UNA_REPLY_word_t word_mask = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((parser == NULL) || (data == NULL)) {
+        return 0;
+    }
+    while ((idx < size) && (parser->state != UNA_REPLY_STATE_COMPLETE)) {
+        // Outside of a reply, only address bytes and frame ends matter: skip other bytes one word at a time.
+        if ((parser->state == UNA_REPLY_STATE_IDLE) || (parser->state == UNA_REPLY_STATE_SKIP)) {
+            while ((size - idx) >= sizeof(UNA_REPLY_word_t)) {
+                __builtin_memcpy(&word, &(data[idx]), sizeof(UNA_REPLY_word_t));
+                word_mask = (word & UNA_REPLY_WORD_HIGH_BITS);
+                if (parser->state == UNA_REPLY_STATE_SKIP) {
+                    word_mask |= _UNA_REPLY_has_zero_byte(word ^ UNA_REPLY_WORD_END_CHAR);
+                }
+                if (word_mask != 0) {
+                    break;
+                }
+                idx += sizeof(UNA_REPLY_word_t);
+            }
+            if (idx >= size) {
+                break;
+            }
+        }
+        _UNA_REPLY_step(parser, data[idx]);
+        idx++;
+    }
+    return idx;
+}
+
+/*******************************************************************/
+uint8_t UNA_REPLY_is_complete(UNA_reply_parser_t* parser) {
+    return (((parser != NULL) && (parser->state == UNA_REPLY_STATE_COMPLETE)) ? 1 : 0);
+}
+
+/*******************************************************************/
+UNA_REPLY_status_t UNA_REPLY_get_access_status(UNA_reply_parser_t* parser, UNA_access_status_t* access_status) {
+    // Local variables.
+    UNA_REPLY_status_t status = UNA_REPLY_SUCCESS;
+    // Check parameters.
+    if ((parser == NULL) || (access_status == NULL)) {
+        status = UNA_REPLY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (access_status->all) = parser->access_status.all;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_REPLY_status_t UNA_REPLY_get_result(UNA_reply_parser_t* parser, uint32_t* reg_value, UNA_access_status_t* access_status) {
+    // Local variables.
+    UNA_REPLY_status_t status = UNA_REPLY_SUCCESS;
+    // Check parameters.
+    if ((parser == NULL) || (reg_value == NULL) || (access_status == NULL)) {
+        status = UNA_REPLY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (parser->state != UNA_REPLY_STATE_COMPLETE) {
+        status = UNA_REPLY_ERROR_NOT_COMPLETE;
+        goto errors;
+    }
+    (access_status->all) = parser->access_status.all;
+    (*reg_value) = ((parser->access_status.flags == 0) && (parser->reply_type == UNA_REPLY_TYPE_VALUE)) ? parser->reg_value : 0;
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,270 @@
+/*
+ * una_rtt.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_rtt.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA RTT local macros ***/
+
+#define UNA_RTT_PERCENTILE_MIN          50
+#define UNA_RTT_PERCENTILE_MAX          99
+#define UNA_RTT_PERCENTILE_STEP_SHIFT   7
+
+#define UNA_RTT_SAMPLE_COUNT_MAX        0xFFFF
+#define UNA_RTT_TIMEOUT_COUNT_MAX       0xFF
+#define UNA_RTT_BACKOFF_LEVEL_MAX       16
+
+/*** UNA RTT local functions ***/
+
+/*******************************************************************/
+static inline uint8_t _UNA_RTT_is_backoff(UNA_rtt_t* rtt, UNA_rtt_node_t* node, uint32_t now_ms) {
+    // Signed difference handles the time counter roll-over.
+    return (((rtt->configuration.backoff_threshold != 0) && (node->timeout_count >= rtt->configuration.backoff_threshold) && (((int32_t) (now_ms - node->next_access_ms)) < 0)) ? 1 : 0);
+}
+
+/*******************************************************************/
+static uint32_t _UNA_RTT_compute_timeout(UNA_rtt_t* rtt, UNA_rtt_node_t* node) {
+    // Local variables.
+    uint32_t timeout_ms = rtt->configuration.timeout_default_ms;
+    uint32_t percentile_ms = 0;
+    // Retransmission timeout estimator, with the tracked percentile as lower bound.
+    if (node->sample_count != 0) {
+        timeout_ms = (node->srtt_x8 >> 3) + node->rttvar_x4;
+        percentile_ms = ((node->percentile_x16 + 15) >> 4);
+        if (percentile_ms > timeout_ms) {
+            timeout_ms = percentile_ms;
+        }
+    }
+    // The previous timeout may have been too short.
+    if (node->timeout_count != 0) {
+        timeout_ms <<= 1;
+    }
+    if (timeout_ms < rtt->configuration.timeout_min_ms) {
+        timeout_ms = rtt->configuration.timeout_min_ms;
+    }
+    if (timeout_ms > rtt->configuration.timeout_max_ms) {
+        timeout_ms = rtt->configuration.timeout_max_ms;
+    }
+    return timeout_ms;
+}
+
+/*******************************************************************/
+static void _UNA_RTT_sample(UNA_rtt_t* rtt, UNA_rtt_node_t* node, uint32_t rtt_ms) {
+    // Local variables.
+    uint32_t rtt_x16 = 0;
+    uint32_t step_x16 = 0;
+    int32_t error = 0;
+    // Avoid fixed point overflows.
+    if (rtt_ms > rtt->configuration.timeout_max_ms) {
+        rtt_ms = rtt->configuration.timeout_max_ms;
+    }
+    rtt_x16 = (rtt_ms << 4);
+    if (node->sample_count == 0) {
+        node->srtt_x8 = (rtt_ms << 3);
+        node->rttvar_x4 = (rtt_ms << 1);
+        node->percentile_x16 = rtt_x16;
+    }
+    else {
+        // Smoothed RTT with gain 1/8 and mean deviation with gain 1/4.
+        error = (int32_t) (rtt_ms - (node->srtt_x8 >> 3));
+        node->srtt_x8 += error;
+        if (error < 0) {
+            error = (-error);
+        }
+        node->rttvar_x4 += (error - (node->rttvar_x4 >> 2));
+        // Streaming percentile: the steps up and down are balanced when the given fraction of samples is below the estimate.
+        step_x16 = ((node->percentile_x16 >> UNA_RTT_PERCENTILE_STEP_SHIFT) + 1);
+        if (rtt_x16 > node->percentile_x16) {
+            node->percentile_x16 += ((step_x16 * rtt->percentile_up_factor_x16) >> 4);
+        }
+        else {
+            node->percentile_x16 -= ((node->percentile_x16 - rtt_x16) < step_x16) ? (node->percentile_x16 - rtt_x16) : step_x16;
+        }
+    }
+    if (node->sample_count < UNA_RTT_SAMPLE_COUNT_MAX) {
+        node->sample_count++;
+    }
+}
+
+/*** UNA RTT functions ***/
+
+/*******************************************************************/
+UNA_RTT_status_t UNA_RTT_init(UNA_rtt_t* rtt, UNA_rtt_node_t* node_table, UNA_rtt_configuration_t* configuration) {
+    // Local variables.
+    UNA_RTT_status_t status = UNA_RTT_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((rtt == NULL) || (node_table == NULL) || (configuration == NULL)) {
+        status = UNA_RTT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((configuration->timeout_max_ms == 0) || (configuration->timeout_min_ms > configuration->timeout_max_ms) || (configuration->percentile < UNA_RTT_PERCENTILE_MIN) || (configuration->percentile > UNA_RTT_PERCENTILE_MAX) || (configuration->backoff_period_ms > configuration->backoff_period_max_ms)) {
+        status = UNA_RTT_ERROR_CONFIGURATION;
+        goto errors;
+    }
+    rtt->node_table = node_table;
+    rtt->configuration = (*configuration);
+    rtt->percentile_up_factor_x16 = ((((uint32_t) configuration->percentile) << 4) / (100 - configuration->percentile));
+    for (idx = 0; idx < UNA_NODE_ADDRESS_LAST; idx++) {
+        node_table[idx].srtt_x8 = 0;
+        node_table[idx].rttvar_x4 = 0;
+        node_table[idx].percentile_x16 = 0;
+        node_table[idx].next_access_ms = 0;
+        node_table[idx].sample_count = 0;
+        node_table[idx].timeout_count = 0;
+        node_table[idx].backoff_level = 0;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_RTT_status_t UNA_RTT_get_timeout(UNA_rtt_t* rtt, UNA_node_address_t node_addr, uint32_t now_ms, uint32_t* timeout_ms) {
+    // Local variables.
+    UNA_RTT_status_t status = UNA_RTT_SUCCESS;
+    UNA_rtt_node_t* node = NULL;
+    // Check parameters.
+    if ((rtt == NULL) || (timeout_ms == NULL)) {
+        status = UNA_RTT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_RTT_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    node = &(rtt->node_table[node_addr]);
+    (*timeout_ms) = _UNA_RTT_compute_timeout(rtt, node);
+    if (_UNA_RTT_is_backoff(rtt, node, now_ms) != 0) {
+        status = UNA_RTT_ERROR_BACKOFF;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_RTT_status_t UNA_RTT_apply(UNA_rtt_t* rtt, UNA_access_parameters_t* access_params, uint32_t now_ms) {
+    // Local variables.
+    UNA_RTT_status_t status = UNA_RTT_SUCCESS;
+    uint32_t timeout_ms = 0;
+    // Check parameters.
+    if (access_params == NULL) {
+        status = UNA_RTT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    status = UNA_RTT_get_timeout(rtt, access_params->node_addr, now_ms, &timeout_ms);
+    if ((status != UNA_RTT_SUCCESS) && (status != UNA_RTT_ERROR_BACKOFF)) {
+        goto errors;
+    }
+    if (access_params->reply_params.type != UNA_REPLY_TYPE_NONE) {
+        access_params->reply_params.timeout_ms = timeout_ms;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_RTT_status_t UNA_RTT_update(UNA_rtt_t* rtt, UNA_node_address_t node_addr, UNA_access_status_t access_status, uint32_t rtt_ms, uint32_t now_ms) {
+    // Local variables.
+    UNA_RTT_status_t status = UNA_RTT_SUCCESS;
+    UNA_rtt_node_t* node = NULL;
+    uint32_t period_ms = 0;
+    // Check parameters.
+    if (rtt == NULL) {
+        status = UNA_RTT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_RTT_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    node = &(rtt->node_table[node_addr]);
+    if ((access_status.reply_timeout != 0) || (access_status.sequence_timeout != 0)) {
+        if (node->timeout_count < UNA_RTT_TIMEOUT_COUNT_MAX) {
+            node->timeout_count++;
+        }
+        if ((rtt->configuration.backoff_threshold != 0) && (node->timeout_count >= rtt->configuration.backoff_threshold)) {
+            // Exponential backoff of the absent nodes, clamped before shifting so that the period never wraps.
+            if ((node->backoff_level >= UNA_RTT_BACKOFF_LEVEL_MAX) || (rtt->configuration.backoff_period_ms > (rtt->configuration.backoff_period_max_ms >> node->backoff_level))) {
+                period_ms = rtt->configuration.backoff_period_max_ms;
+            }
+            else {
+                period_ms = (rtt->configuration.backoff_period_ms << node->backoff_level);
+                node->backoff_level++;
+            }
+            node->next_access_ms = (now_ms + period_ms);
+        }
+    }
+    else if (access_status.parser_error == 0) {
+        // Error replies are valid round-trip time samples.
+        _UNA_RTT_sample(rtt, node, rtt_ms);
+        node->timeout_count = 0;
+        node->backoff_level = 0;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_RTT_status_t UNA_RTT_get_statistics(UNA_rtt_t* rtt, UNA_node_address_t node_addr, uint32_t now_ms, UNA_rtt_statistics_t* statistics) {
+    // Local variables.
+    UNA_RTT_status_t status = UNA_RTT_SUCCESS;
+    UNA_rtt_node_t* node = NULL;
+    // Check parameters.
+    if ((rtt == NULL) || (statistics == NULL)) {
+        status = UNA_RTT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_RTT_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    node = &(rtt->node_table[node_addr]);
+    statistics->srtt_ms = (node->srtt_x8 >> 3);
+    statistics->rttvar_ms = (node->rttvar_x4 >> 2);
+    statistics->percentile_ms = ((node->percentile_x16 + 15) >> 4);
+    statistics->timeout_ms = _UNA_RTT_compute_timeout(rtt, node);
+    statistics->sample_count = node->sample_count;
+    statistics->timeout_count = node->timeout_count;
+    statistics->backoff = _UNA_RTT_is_backoff(rtt, node, now_ms);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_RTT_status_t UNA_RTT_get_cycle_time(UNA_rtt_t* rtt, UNA_node_list_t* node_list, uint32_t now_ms, uint32_t* cycle_time_ms) {
+    // Local variables.
+    UNA_RTT_status_t status = UNA_RTT_SUCCESS;
+    UNA_rtt_node_t* node = NULL;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((rtt == NULL) || (node_list == NULL) || (cycle_time_ms == NULL)) {
+        status = UNA_RTT_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*cycle_time_ms) = 0;
+    for (idx = 0; (idx < node_list->count) && (idx < UNA_NODE_ADDRESS_LAST); idx++) {
+        if (node_list->list[idx].address >= UNA_NODE_ADDRESS_LAST) {
+            continue;
+        }
+        node = &(rtt->node_table[node_list->list[idx].address]);
+        if (_UNA_RTT_is_backoff(rtt, node, now_ms) == 0) {
+            (*cycle_time_ms) += _UNA_RTT_compute_timeout(rtt, node);
+        }
+    }
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
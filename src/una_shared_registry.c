@@ -0,0 +1,229 @@
+/*
+ * una_shared_registry.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_shared_registry.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+#include "una_lockfree.h"
+#include "una_registry.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA SHARED REGISTRY local macros ***/
+
+#define UNA_SHARED_REGISTRY_PUBLISHED_BUFFER(version)   ((version) & 0b1)
+#define UNA_SHARED_REGISTRY_WRITER_BUFFER(version)      (((version) + 1) & 0b1)
+
+/*** UNA SHARED REGISTRY functions ***/
+
+/*******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_init(UNA_shared_registry_t* registry, UNA_shared_registry_shard_t* shard_table, uint8_t shard_number) {
+    // Local variables.
+    UNA_SHARED_REGISTRY_status_t status = UNA_SHARED_REGISTRY_SUCCESS;
+    UNA_shared_registry_shard_t* shard = NULL;
+    uint8_t shard_idx = 0;
+    uint8_t buffer_idx = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((registry == NULL) || (shard_table == NULL)) {
+        status = UNA_SHARED_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (shard_number == 0) {
+        status = UNA_SHARED_REGISTRY_ERROR_SHARD_INDEX;
+        goto errors;
+    }
+    registry->shard_table = shard_table;
+    registry->shard_number = shard_number;
+    for (shard_idx = 0; shard_idx < shard_number; shard_idx++) {
+        shard = &(shard_table[shard_idx]);
+        shard->version = 0;
+        for (buffer_idx = 0; buffer_idx < 2; buffer_idx++) {
+            UNA_REGISTRY_reset(&(shard->buffer[buffer_idx]));
+            // Lock-free readers may dereference slots of a buffer being rewritten, they must always be in range.
+            for (idx = 0; idx < UNA_NODE_ADDRESS_LAST; idx++) {
+                shard->buffer[buffer_idx].slot[idx] = 0;
+            }
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_publish_node_list(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_node_list_t* node_list) {
+    // Local variables.
+    UNA_SHARED_REGISTRY_status_t status = UNA_SHARED_REGISTRY_SUCCESS;
+    UNA_shared_registry_shard_t* shard = NULL;
+    // Check parameters.
+    if ((registry == NULL) || (node_list == NULL)) {
+        status = UNA_SHARED_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (shard_index >= registry->shard_number) {
+        status = UNA_SHARED_REGISTRY_ERROR_SHARD_INDEX;
+        goto errors;
+    }
+    shard = &(registry->shard_table[shard_index]);
+    // Previous publication is visible before the writer buffer, which late readers may still copy, is modified.
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    // Build the new list aside, readers keep using the published buffer.
+    if (UNA_REGISTRY_import_node_list(&(shard->buffer[UNA_SHARED_REGISTRY_WRITER_BUFFER(shard->version)]), node_list) != UNA_REGISTRY_SUCCESS) {
+        status = UNA_SHARED_REGISTRY_ERROR_NODE_LIST;
+        goto errors;
+    }
+    // Writer copy content is visible before it becomes the published buffer.
+    UNA_LOCKFREE_write_end(&(shard->version));
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_begin_update(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_registry_t** registry_copy) {
+    // Local variables.
+    UNA_SHARED_REGISTRY_status_t status = UNA_SHARED_REGISTRY_SUCCESS;
+    UNA_shared_registry_shard_t* shard = NULL;
+    // Check parameters.
+    if ((registry == NULL) || (registry_copy == NULL)) {
+        status = UNA_SHARED_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (shard_index >= registry->shard_number) {
+        status = UNA_SHARED_REGISTRY_ERROR_SHARD_INDEX;
+        goto errors;
+    }
+    shard = &(registry->shard_table[shard_index]);
+    // Previous publication is visible before the writer buffer, which late readers may still copy, is modified.
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    shard->buffer[UNA_SHARED_REGISTRY_WRITER_BUFFER(shard->version)] = shard->buffer[UNA_SHARED_REGISTRY_PUBLISHED_BUFFER(shard->version)];
+    (*registry_copy) = &(shard->buffer[UNA_SHARED_REGISTRY_WRITER_BUFFER(shard->version)]);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_commit(UNA_shared_registry_t* registry, uint8_t shard_index) {
+    // Local variables.
+    UNA_SHARED_REGISTRY_status_t status = UNA_SHARED_REGISTRY_SUCCESS;
+    // Check parameters.
+    if (registry == NULL) {
+        status = UNA_SHARED_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (shard_index >= registry->shard_number) {
+        status = UNA_SHARED_REGISTRY_ERROR_SHARD_INDEX;
+        goto errors;
+    }
+    UNA_LOCKFREE_write_end(&(registry->shard_table[shard_index].version));
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_get_version(UNA_shared_registry_t* registry, uint8_t shard_index, uint32_t* version) {
+    // Local variables.
+    UNA_SHARED_REGISTRY_status_t status = UNA_SHARED_REGISTRY_SUCCESS;
+    // Check parameters.
+    if ((registry == NULL) || (version == NULL)) {
+        status = UNA_SHARED_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (shard_index >= registry->shard_number) {
+        status = UNA_SHARED_REGISTRY_ERROR_SHARD_INDEX;
+        goto errors;
+    }
+    (*version) = UNA_LOCKFREE_read_version(&(registry->shard_table[shard_index].version));
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_get_node(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_node_address_t node_addr, UNA_node_t* node) {
+    // Local variables.
+    UNA_SHARED_REGISTRY_status_t status = UNA_SHARED_REGISTRY_SUCCESS;
+    UNA_shared_registry_shard_t* shard = NULL;
+    UNA_registry_t* published = NULL;
+    uint32_t version = 0;
+    uint8_t present = 0;
+    uint8_t board_id = 0;
+    // Check parameters.
+    if ((registry == NULL) || (node == NULL)) {
+        status = UNA_SHARED_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (shard_index >= registry->shard_number) {
+        status = UNA_SHARED_REGISTRY_ERROR_SHARD_INDEX;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_SHARED_REGISTRY_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    shard = &(registry->shard_table[shard_index]);
+    // Read until a consistent snapshot is obtained.
+    do {
+        version = UNA_LOCKFREE_read_version(&(shard->version));
+        published = &(shard->buffer[UNA_SHARED_REGISTRY_PUBLISHED_BUFFER(version)]);
+        present = UNA_REGISTRY_is_node_present(published, node_addr);
+        board_id = published->node[published->slot[node_addr]].board_id;
+    }
+    while (UNA_LOCKFREE_read_retry(&(shard->version), version) != 0);
+    if (present == 0) {
+        status = UNA_SHARED_REGISTRY_ERROR_NODE_NOT_FOUND;
+        goto errors;
+    }
+    node->address = node_addr;
+    node->board_id = (UNA_board_id_t) board_id;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_SHARED_REGISTRY_status_t UNA_SHARED_REGISTRY_snapshot(UNA_shared_registry_t* registry, uint8_t shard_index, UNA_node_list_t* node_list, uint32_t* version) {
+    // Local variables.
+    UNA_SHARED_REGISTRY_status_t status = UNA_SHARED_REGISTRY_SUCCESS;
+    UNA_shared_registry_shard_t* shard = NULL;
+    UNA_registry_t* published = NULL;
+    uint32_t published_version = 0;
+    uint8_t count = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((registry == NULL) || (node_list == NULL)) {
+        status = UNA_SHARED_REGISTRY_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (shard_index >= registry->shard_number) {
+        status = UNA_SHARED_REGISTRY_ERROR_SHARD_INDEX;
+        goto errors;
+    }
+    shard = &(registry->shard_table[shard_index]);
+    // Copy until a consistent snapshot is obtained.
+    do {
+        published_version = UNA_LOCKFREE_read_version(&(shard->version));
+        published = &(shard->buffer[UNA_SHARED_REGISTRY_PUBLISHED_BUFFER(published_version)]);
+        UNA_reset_node_list(node_list);
+        count = published->count;
+        // Count is bounded in case it is read while the buffer is rewritten.
+        for (idx = 0; (idx < count) && (idx < UNA_NODE_ADDRESS_LAST); idx++) {
+            node_list->list[idx].address = (UNA_node_address_t) published->node[idx].address;
+            node_list->list[idx].board_id = (UNA_board_id_t) published->node[idx].board_id;
+        }
+    }
+    while (UNA_LOCKFREE_read_retry(&(shard->version), published_version) != 0);
+    node_list->count = count;
+    if (version != NULL) {
+        (*version) = published_version;
+    }
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,342 @@
+/*
+ * una_sim.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_sim.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+#include "una_async.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA SIM local macros ***/
+
+#define UNA_SIM_PERCENT_MAX                 100
+
+#define UNA_SIM_VMCU_MV                     3300
+#define UNA_SIM_TMCU_TENTH_DEGREES          250
+#define UNA_SIM_INPUT_VOLTAGE_MV            12000
+#define UNA_SIM_INPUT_VOLTAGE_RANGE_MV      2000
+#define UNA_SIM_CURRENT_RANGE_UA            5000000
+#define UNA_SIM_ENERGY_RANGE_MWH            100000000
+#define UNA_SIM_POWER_FACTOR_MIN            80
+#define UNA_SIM_POWER_FACTOR_RANGE          20
+
+#define UNA_SIM_BUS_INDEX_ALL               0xFF
+
+/*** UNA SIM local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t active;
+    uint8_t reply_dropped;
+    uint32_t reply_time_ms;
+    uint32_t reg_value;
+    UNA_access_status_t access_status;
+} UNA_SIM_bus_t;
+
+/*******************************************************************/
+typedef struct {
+    UNA_sim_node_t* node_table;
+    uint32_t random_state;
+    uint32_t now_ms;
+    uint32_t bus_time_ms;
+    UNA_SIM_bus_t bus[UNA_SIM_BUS_NUMBER_MAX];
+} UNA_SIM_context_t;
+
+/*** UNA SIM local functions declaration ***/
+
+static void _UNA_SIM_send(uint8_t bus_index, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask);
+static uint8_t _UNA_SIM_poll(uint8_t bus_index, uint32_t* reg_value, UNA_access_status_t* access_status);
+static void _UNA_SIM_abort(uint8_t bus_index);
+
+/*** UNA SIM global variables ***/
+
+const UNA_transport_t UNA_SIM_TRANSPORT = {
+    &UNA_SIM_read_register,
+    &UNA_SIM_write_register
+};
+
+const UNA_async_transport_t UNA_SIM_ASYNC_TRANSPORT = {
+    &_UNA_SIM_send,
+    &_UNA_SIM_poll,
+    &_UNA_SIM_abort
+};
+
+/*** UNA SIM local global variables ***/
+
+static UNA_SIM_context_t una_sim_ctx = {
+    .node_table = NULL,
+    .random_state = 1,
+    .now_ms = 0,
+    .bus_time_ms = 0
+};
+
+/*** UNA SIM local functions ***/
+
+/*******************************************************************/
+static uint32_t _UNA_SIM_random(uint32_t range) {
+    // Xorshift generator, reproducible from the seed.
+    una_sim_ctx.random_state ^= (una_sim_ctx.random_state << 13);
+    una_sim_ctx.random_state ^= (una_sim_ctx.random_state >> 17);
+    una_sim_ctx.random_state ^= (una_sim_ctx.random_state << 5);
+    return ((range == 0) ? 0 : (una_sim_ctx.random_state % range));
+}
+
+/*******************************************************************/
+static void _UNA_SIM_fill_registers(UNA_node_address_t node_addr) {
+    // Local variables.
+    UNA_sim_node_t* node = &(una_sim_ctx.node_table[node_addr]);
+    uint32_t current_ua = _UNA_SIM_random(UNA_SIM_CURRENT_RANGE_UA);
+    uint32_t voltage_mv = UNA_SIM_INPUT_VOLTAGE_MV + _UNA_SIM_random(UNA_SIM_INPUT_VOLTAGE_RANGE_MV);
+    uint8_t idx = 0;
+    for (idx = 0; idx < UNA_SIM_REGISTER_NUMBER; idx++) {
+        node->reg[idx] = 0;
+    }
+    // Realistic measurements encoded with the UNA representations.
+    node->reg[UNA_SIM_REGISTER_NODE_ID] = ((uint32_t) node_addr) | (((uint32_t) node->board_id) << 8);
+    node->reg[UNA_SIM_REGISTER_ANALOG_DATA_0] = UNA_convert_mv(UNA_SIM_VMCU_MV) | (UNA_convert_tenth_degrees(UNA_SIM_TMCU_TENTH_DEGREES) << 16);
+    node->reg[UNA_SIM_REGISTER_ANALOG_DATA_1] = UNA_convert_mv((int32_t) voltage_mv) | (UNA_convert_ua((int32_t) current_ua) << 16);
+    node->reg[UNA_SIM_REGISTER_ANALOG_DATA_2] = UNA_convert_mw_mva((int32_t) (((uint64_t) voltage_mv * (uint64_t) current_ua) / 1000000));
+    node->reg[UNA_SIM_REGISTER_ANALOG_DATA_3] = UNA_convert_mwh_mvah((int32_t) _UNA_SIM_random(UNA_SIM_ENERGY_RANGE_MWH)) | (UNA_convert_power_factor((int32_t) (UNA_SIM_POWER_FACTOR_MIN + _UNA_SIM_random(UNA_SIM_POWER_FACTOR_RANGE))) << 16);
+}
+
+/*******************************************************************/
+static uint32_t _UNA_SIM_access(uint8_t bus_index, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t* reg_value, uint32_t reg_mask, UNA_access_status_t* access_status) {
+    // Local variables.
+    UNA_sim_node_t* node = NULL;
+    uint32_t duration_ms = access_params->reply_params.timeout_ms;
+    access_status->all = 0;
+    access_status->type = access_type;
+    // Absent nodes never reply.
+    if ((una_sim_ctx.node_table == NULL) || (access_params->node_addr >= UNA_NODE_ADDRESS_LAST)) {
+        access_status->reply_timeout = 1;
+        goto errors;
+    }
+    node = &(una_sim_ctx.node_table[access_params->node_addr]);
+    // Nodes connected to another bus segment never see the frame.
+    if ((node->board_id == UNA_BOARD_ID_ERROR) || ((bus_index != UNA_SIM_BUS_INDEX_ALL) && (node->bus_index != bus_index))) {
+        access_status->reply_timeout = 1;
+        goto errors;
+    }
+    if (_UNA_SIM_random(UNA_SIM_PERCENT_MAX) < node->faults.reply_timeout_percent) {
+        access_status->reply_timeout = 1;
+        goto errors;
+    }
+    duration_ms = node->latency_ms;
+    // Injected faults.
+    if (_UNA_SIM_random(UNA_SIM_PERCENT_MAX) < node->faults.parser_error_percent) {
+        access_status->parser_error = 1;
+        goto errors;
+    }
+    if ((access_params->reg_addr >= UNA_SIM_REGISTER_NUMBER) || (_UNA_SIM_random(UNA_SIM_PERCENT_MAX) < node->faults.error_received_percent)) {
+        access_status->error_received = 1;
+        goto errors;
+    }
+    // Register access.
+    if (access_type == UNA_ACCESS_TYPE_WRITE) {
+        node->reg[access_params->reg_addr] = (node->reg[access_params->reg_addr] & (~reg_mask)) | ((*reg_value) & reg_mask);
+    }
+    else {
+        (*reg_value) = node->reg[access_params->reg_addr];
+    }
+errors:
+    return duration_ms;
+}
+
+/*******************************************************************/
+static void _UNA_SIM_send(uint8_t bus_index, UNA_access_type_t access_type, UNA_access_parameters_t* access_params, uint32_t reg_value, uint32_t reg_mask) {
+    // Local variables.
+    UNA_SIM_bus_t* bus = NULL;
+    // Check parameters.
+    if ((bus_index >= UNA_SIM_BUS_NUMBER_MAX) || (access_params == NULL)) {
+        return;
+    }
+    bus = &(una_sim_ctx.bus[bus_index]);
+    bus->reg_value = reg_value;
+    // Compute reply immediately and release it after the node latency.
+    bus->reply_time_ms = una_sim_ctx.now_ms + _UNA_SIM_access(bus_index, access_type, access_params, &(bus->reg_value), reg_mask, &(bus->access_status));
+    bus->reply_dropped = bus->access_status.reply_timeout;
+    bus->active = 1;
+}
+
+/*******************************************************************/
+static uint8_t _UNA_SIM_poll(uint8_t bus_index, uint32_t* reg_value, UNA_access_status_t* access_status) {
+    // Local variables.
+    UNA_SIM_bus_t* bus = NULL;
+    // Check parameters.
+    if ((bus_index >= UNA_SIM_BUS_NUMBER_MAX) || (reg_value == NULL) || (access_status == NULL)) {
+        return 0;
+    }
+    bus = &(una_sim_ctx.bus[bus_index]);
+    if ((bus->active == 0) || (bus->reply_dropped != 0) || (((int32_t) (una_sim_ctx.now_ms - bus->reply_time_ms)) < 0)) {
+        return 0;
+    }
+    bus->active = 0;
+    (*reg_value) = bus->reg_value;
+    (*access_status) = bus->access_status;
+    return 1;
+}
+
+/*******************************************************************/
+static void _UNA_SIM_abort(uint8_t bus_index) {
+    if (bus_index < UNA_SIM_BUS_NUMBER_MAX) {
+        una_sim_ctx.bus[bus_index].active = 0;
+    }
+}
+
+/*** UNA SIM functions ***/
+
+/*******************************************************************/
+UNA_SIM_status_t UNA_SIM_init(UNA_sim_node_t* node_table, uint32_t seed) {
+    // Local variables.
+    UNA_SIM_status_t status = UNA_SIM_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameter.
+    if (node_table == NULL) {
+        status = UNA_SIM_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Init context.
+    una_sim_ctx.node_table = node_table;
+    una_sim_ctx.random_state = (seed == 0) ? 1 : seed;
+    una_sim_ctx.now_ms = 0;
+    una_sim_ctx.bus_time_ms = 0;
+    for (idx = 0; idx < UNA_NODE_ADDRESS_LAST; idx++) {
+        node_table[idx].board_id = UNA_BOARD_ID_ERROR;
+    }
+    for (idx = 0; idx < UNA_SIM_BUS_NUMBER_MAX; idx++) {
+        una_sim_ctx.bus[idx].active = 0;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_SIM_status_t UNA_SIM_add_node(UNA_node_address_t node_addr, UNA_board_id_t board_id, uint8_t bus_index, uint32_t latency_ms) {
+    // Local variables.
+    UNA_SIM_status_t status = UNA_SIM_SUCCESS;
+    UNA_sim_node_t* node = NULL;
+    // Check parameters.
+    if (una_sim_ctx.node_table == NULL) {
+        status = UNA_SIM_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_SIM_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    if (bus_index >= UNA_SIM_BUS_NUMBER_MAX) {
+        status = UNA_SIM_ERROR_BUS_INDEX;
+        goto errors;
+    }
+    if (board_id >= UNA_BOARD_ID_LAST) {
+        status = UNA_SIM_ERROR_BOARD_ID;
+        goto errors;
+    }
+    node = &(una_sim_ctx.node_table[node_addr]);
+    node->board_id = board_id;
+    node->bus_index = bus_index;
+    node->latency_ms = latency_ms;
+    node->faults.reply_timeout_percent = 0;
+    node->faults.error_received_percent = 0;
+    node->faults.parser_error_percent = 0;
+    _UNA_SIM_fill_registers(node_addr);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_SIM_status_t UNA_SIM_populate(uint8_t nodes_per_range, uint8_t bus_number, uint32_t latency_ms) {
+    // Local variables.
+    UNA_SIM_status_t status = UNA_SIM_SUCCESS;
+    const UNA_board_id_t single_board[] = { UNA_BOARD_ID_RS485_BRIDGE, UNA_BOARD_ID_BPSM, UNA_BOARD_ID_UHFM, UNA_BOARD_ID_GPSM, UNA_BOARD_ID_SM, UNA_BOARD_ID_MPMCM, UNA_BOARD_ID_BCM };
+    const UNA_board_id_t range_board[] = { UNA_BOARD_ID_LVRM, UNA_BOARD_ID_DDRM, UNA_BOARD_ID_RRM, UNA_BOARD_ID_R4S8CR };
+    const UNA_node_address_t range_start[] = { UNA_NODE_ADDRESS_LVRM_START, UNA_NODE_ADDRESS_DDRM_START, UNA_NODE_ADDRESS_RRM_START, UNA_NODE_ADDRESS_R4S8CR_START };
+    const uint8_t range_size[] = { UNA_NODE_ADDRESS_RANGE_LVRM, UNA_NODE_ADDRESS_RANGE_DDRM, UNA_NODE_ADDRESS_RANGE_RRM, UNA_NODE_ADDRESS_RANGE_R4S8CR };
+    uint8_t node_count = 0;
+    uint8_t idx = 0;
+    uint8_t range_idx = 0;
+    // Check parameters.
+    if ((bus_number == 0) || (bus_number > UNA_SIM_BUS_NUMBER_MAX)) {
+        status = UNA_SIM_ERROR_BUS_INDEX;
+        goto errors;
+    }
+    // Single address boards.
+    for (idx = 0; idx < (sizeof(single_board) / sizeof(UNA_board_id_t)); idx++) {
+        status = UNA_SIM_add_node((UNA_node_address_t) (UNA_NODE_ADDRESS_RS485_BRIDGE + idx), single_board[idx], (node_count++ % bus_number), latency_ms);
+        if (status != UNA_SIM_SUCCESS) {
+            goto errors;
+        }
+    }
+    // Address ranges.
+    for (range_idx = 0; range_idx < (sizeof(range_board) / sizeof(UNA_board_id_t)); range_idx++) {
+        for (idx = 0; (idx < nodes_per_range) && (idx < range_size[range_idx]); idx++) {
+            status = UNA_SIM_add_node((UNA_node_address_t) (range_start[range_idx] + idx), range_board[range_idx], (node_count++ % bus_number), latency_ms);
+            if (status != UNA_SIM_SUCCESS) {
+                goto errors;
+            }
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_SIM_status_t UNA_SIM_set_faults(UNA_node_address_t node_addr, UNA_sim_faults_t* faults) {
+    // Local variables.
+    UNA_SIM_status_t status = UNA_SIM_SUCCESS;
+    // Check parameters.
+    if ((una_sim_ctx.node_table == NULL) || (faults == NULL)) {
+        status = UNA_SIM_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_SIM_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    if ((faults->reply_timeout_percent > UNA_SIM_PERCENT_MAX) || (faults->error_received_percent > UNA_SIM_PERCENT_MAX) || (faults->parser_error_percent > UNA_SIM_PERCENT_MAX)) {
+        status = UNA_SIM_ERROR_RATE;
+        goto errors;
+    }
+    una_sim_ctx.node_table[node_addr].faults = (*faults);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void UNA_SIM_set_time_ms(uint32_t now_ms) {
+    una_sim_ctx.now_ms = now_ms;
+}
+
+/*******************************************************************/
+uint32_t UNA_SIM_get_bus_time_ms(void) {
+    return (una_sim_ctx.bus_time_ms);
+}
+
+/*******************************************************************/
+void UNA_SIM_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status) {
+    // Check parameters.
+    if ((read_params == NULL) || (reg_value == NULL) || (read_status == NULL)) {
+        return;
+    }
+    una_sim_ctx.bus_time_ms += _UNA_SIM_access(UNA_SIM_BUS_INDEX_ALL, UNA_ACCESS_TYPE_READ, read_params, reg_value, UNA_REGISTER_MASK_NONE, read_status);
+}
+
+/*******************************************************************/
+void UNA_SIM_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status) {
+    // Check parameters.
+    if ((write_params == NULL) || (write_status == NULL)) {
+        return;
+    }
+    una_sim_ctx.bus_time_ms += _UNA_SIM_access(UNA_SIM_BUS_INDEX_ALL, UNA_ACCESS_TYPE_WRITE, write_params, &reg_value, reg_mask, write_status);
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,270 @@
+/*
+ * una_stats.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_stats.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+#include "una_lockfree.h"
+
+#ifndef UNA_LIB_DISABLE
+
+/*** UNA STATS local macros ***/
+
+#define UNA_STATS_KEY(node_addr, reg_addr)  ((uint16_t) ((((uint16_t) (node_addr)) << 8) | ((uint16_t) (reg_addr))))
+
+/*** UNA STATS local functions ***/
+
+/*******************************************************************/
+static UNA_stats_entry_t* _UNA_STATS_find(UNA_stats_t* stats, uint16_t key, uint8_t insert) {
+    // Local variables.
+    UNA_stats_entry_t* entry = NULL;
+    uint16_t entry_key = 0;
+    uint16_t idx = UNA_LOCKFREE_HASH(key);
+    uint16_t probe = 0;
+    uint8_t counter_idx = 0;
+    // Linear probing, entries are never removed so the first empty slot ends the search.
+    for (probe = 0; probe < stats->register_table_size; probe++) {
+        entry = &(stats->register_table[(idx + probe) & (stats->register_table_size - 1)]);
+        entry_key = __atomic_load_n(&(entry->key), __ATOMIC_ACQUIRE);
+        if (entry_key == key) {
+            return entry;
+        }
+        if (entry_key == UNA_STATS_KEY_NONE) {
+            if (insert == 0) {
+                break;
+            }
+            // Entry content is initialized before the key is published to readers.
+            for (counter_idx = 0; counter_idx < UNA_STATS_COUNTER_LAST; counter_idx++) {
+                entry->count[counter_idx] = 0;
+            }
+            entry->tx_bytes = 0;
+            entry->rx_bytes = 0;
+            __atomic_store_n(&(entry->key), key, __ATOMIC_RELEASE);
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************/
+static void _UNA_STATS_clear(UNA_stats_entry_t* entry, uint16_t key) {
+    // Local variables.
+    uint8_t idx = 0;
+    entry->sequence = 0;
+    entry->key = key;
+    for (idx = 0; idx < UNA_STATS_COUNTER_LAST; idx++) {
+        entry->count[idx] = 0;
+    }
+    entry->tx_bytes = 0;
+    entry->rx_bytes = 0;
+}
+
+/*******************************************************************/
+static void _UNA_STATS_add(UNA_stats_entry_t* entry, UNA_stats_counter_t outcome, uint32_t tx_bytes, uint32_t rx_bytes) {
+    UNA_LOCKFREE_write_begin(&(entry->sequence));
+    entry->count[outcome]++;
+    entry->tx_bytes += tx_bytes;
+    entry->rx_bytes += rx_bytes;
+    UNA_LOCKFREE_write_end(&(entry->sequence));
+}
+
+/*******************************************************************/
+static void _UNA_STATS_copy(UNA_stats_entry_t* entry, UNA_stats_counters_t* counters) {
+    // Local variables.
+    uint32_t sequence = 0;
+    uint8_t idx = 0;
+    // Copy entry until a consistent snapshot is obtained.
+    do {
+        sequence = UNA_LOCKFREE_read_begin(&(entry->sequence));
+        for (idx = 0; idx < UNA_STATS_COUNTER_LAST; idx++) {
+            counters->count[idx] = __atomic_load_n(&(entry->count[idx]), __ATOMIC_RELAXED);
+        }
+        // 64-bits counters may be torn on 32-bits targets, in which case the sequence number has changed.
+        counters->tx_bytes = entry->tx_bytes;
+        counters->rx_bytes = entry->rx_bytes;
+    }
+    while (UNA_LOCKFREE_read_retry(&(entry->sequence), sequence) != 0);
+}
+
+/*** UNA STATS functions ***/
+
+/*******************************************************************/
+UNA_STATS_status_t UNA_STATS_init(UNA_stats_t* stats, UNA_stats_entry_t* node_table, UNA_stats_entry_t* register_table, uint16_t register_table_size) {
+    // Local variables.
+    UNA_STATS_status_t status = UNA_STATS_SUCCESS;
+    // Check parameters.
+    if ((stats == NULL) || ((register_table == NULL) && (register_table_size != 0))) {
+        status = UNA_STATS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((register_table_size & (register_table_size - 1)) != 0) {
+        status = UNA_STATS_ERROR_SIZE;
+        goto errors;
+    }
+    stats->node_table = node_table;
+    stats->register_table = register_table;
+    stats->register_table_size = register_table_size;
+    UNA_STATS_reset(stats);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void UNA_STATS_reset(UNA_stats_t* stats) {
+    // Local variables.
+    uint16_t idx = 0;
+    // Check parameter.
+    if (stats == NULL) {
+        return;
+    }
+    _UNA_STATS_clear(&(stats->total), UNA_STATS_KEY_NONE);
+    if (stats->node_table != NULL) {
+        for (idx = 0; idx < UNA_NODE_ADDRESS_LAST; idx++) {
+            _UNA_STATS_clear(&(stats->node_table[idx]), idx);
+        }
+    }
+    for (idx = 0; idx < stats->register_table_size; idx++) {
+        _UNA_STATS_clear(&(stats->register_table[idx]), UNA_STATS_KEY_NONE);
+    }
+}
+
+/*******************************************************************/
+UNA_STATS_status_t UNA_STATS_record(UNA_stats_t* stats, UNA_access_parameters_t* access_params, UNA_access_status_t access_status, uint32_t tx_bytes, uint32_t rx_bytes) {
+    // Local variables.
+    UNA_STATS_status_t status = UNA_STATS_SUCCESS;
+    UNA_stats_counter_t outcome = UNA_STATS_COUNTER_READ_SUCCESS;
+    UNA_stats_entry_t* entry = NULL;
+    // Check parameters.
+    if ((stats == NULL) || (access_params == NULL)) {
+        status = UNA_STATS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (access_params->node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_STATS_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    // Most significant flag first.
+    if (access_status.sequence_timeout != 0) {
+        outcome = UNA_STATS_COUNTER_SEQUENCE_TIMEOUT;
+    }
+    else if (access_status.reply_timeout != 0) {
+        outcome = UNA_STATS_COUNTER_REPLY_TIMEOUT;
+    }
+    else if (access_status.parser_error != 0) {
+        outcome = UNA_STATS_COUNTER_PARSER_ERROR;
+    }
+    else if (access_status.error_received != 0) {
+        outcome = UNA_STATS_COUNTER_ERROR_RECEIVED;
+    }
+    else if (access_status.type == UNA_ACCESS_TYPE_WRITE) {
+        outcome = UNA_STATS_COUNTER_WRITE_SUCCESS;
+    }
+    _UNA_STATS_add(&(stats->total), outcome, tx_bytes, rx_bytes);
+    if (stats->node_table != NULL) {
+        _UNA_STATS_add(&(stats->node_table[access_params->node_addr]), outcome, tx_bytes, rx_bytes);
+    }
+    if (stats->register_table_size != 0) {
+        entry = _UNA_STATS_find(stats, UNA_STATS_KEY(access_params->node_addr, access_params->reg_addr), 1);
+        if (entry == NULL) {
+            status = UNA_STATS_ERROR_FULL;
+            goto errors;
+        }
+        _UNA_STATS_add(entry, outcome, tx_bytes, rx_bytes);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_STATS_status_t UNA_STATS_read_total(UNA_stats_t* stats, UNA_stats_counters_t* counters) {
+    // Local variables.
+    UNA_STATS_status_t status = UNA_STATS_SUCCESS;
+    // Check parameters.
+    if ((stats == NULL) || (counters == NULL)) {
+        status = UNA_STATS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    _UNA_STATS_copy(&(stats->total), counters);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_STATS_status_t UNA_STATS_read_node(UNA_stats_t* stats, UNA_node_address_t node_addr, UNA_stats_counters_t* counters) {
+    // Local variables.
+    UNA_STATS_status_t status = UNA_STATS_SUCCESS;
+    // Check parameters.
+    if ((stats == NULL) || (stats->node_table == NULL) || (counters == NULL)) {
+        status = UNA_STATS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_STATS_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    _UNA_STATS_copy(&(stats->node_table[node_addr]), counters);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_STATS_status_t UNA_STATS_read_register(UNA_stats_t* stats, UNA_node_address_t node_addr, uint8_t reg_addr, UNA_stats_counters_t* counters) {
+    // Local variables.
+    UNA_STATS_status_t status = UNA_STATS_SUCCESS;
+    UNA_stats_entry_t* entry = NULL;
+    // Check parameters.
+    if ((stats == NULL) || (counters == NULL)) {
+        status = UNA_STATS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    entry = _UNA_STATS_find(stats, UNA_STATS_KEY(node_addr, reg_addr), 0);
+    if (entry == NULL) {
+        status = UNA_STATS_ERROR_MISS;
+        goto errors;
+    }
+    _UNA_STATS_copy(entry, counters);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_STATS_status_t UNA_STATS_export(UNA_stats_t* stats, UNA_stats_record_t* record_table, uint16_t record_table_size, uint16_t* record_count) {
+    // Local variables.
+    UNA_STATS_status_t status = UNA_STATS_SUCCESS;
+    UNA_stats_entry_t* entry = NULL;
+    uint16_t key = 0;
+    uint16_t idx = 0;
+    // Check parameters.
+    if ((stats == NULL) || (record_table == NULL) || (record_count == NULL)) {
+        status = UNA_STATS_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*record_count) = 0;
+    for (idx = 0; idx < stats->register_table_size; idx++) {
+        entry = &(stats->register_table[idx]);
+        key = __atomic_load_n(&(entry->key), __ATOMIC_ACQUIRE);
+        if (key == UNA_STATS_KEY_NONE) {
+            continue;
+        }
+        if ((*record_count) >= record_table_size) {
+            status = UNA_STATS_ERROR_FULL;
+            goto errors;
+        }
+        record_table[(*record_count)].node_addr = (UNA_node_address_t) (key >> 8);
+        record_table[(*record_count)].reg_addr = (uint8_t) (key & 0xFF);
+        _UNA_STATS_copy(entry, &(record_table[(*record_count)].counters));
+        (*record_count)++;
+    }
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_DISABLE */
@@ -0,0 +1,186 @@
+/*
+ * una_trace.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "una_trace.h"
+
+#ifndef UNA_LIB_DISABLE_FLAGS_FILE
+#include "una_lib_flags.h"
+#endif
+#include "types.h"
+#include "una.h"
+
+#ifndef UNA_LIB_DISABLE
+
+#ifdef UNA_LIB_USE_TRACE
+
+/*** UNA TRACE local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    UNA_TRACE_get_timestamp_cb_t get_timestamp;
+    UNA_trace_histogram_t* histogram_table;
+    UNA_trace_histogram_t* node_histogram_table;
+} UNA_TRACE_context_t;
+
+/*** UNA TRACE local global variables ***/
+
+static UNA_TRACE_context_t una_trace_ctx = {
+    .get_timestamp = NULL,
+    .histogram_table = NULL,
+    .node_histogram_table = NULL
+};
+
+/*** UNA TRACE local functions ***/
+
+/*******************************************************************/
+static void _UNA_TRACE_clear(UNA_trace_histogram_t* histogram) {
+    // Local variables.
+    uint8_t idx = 0;
+    for (idx = 0; idx < UNA_TRACE_HISTOGRAM_BUCKET_NUMBER; idx++) {
+        histogram->bucket[idx] = 0;
+    }
+    histogram->count = 0;
+    histogram->max = 0;
+}
+
+/*******************************************************************/
+static inline void _UNA_TRACE_add(UNA_trace_histogram_t* histogram, uint8_t bucket_index, uint32_t duration) {
+    histogram->bucket[bucket_index]++;
+    histogram->count++;
+    if (duration > histogram->max) {
+        histogram->max = duration;
+    }
+}
+
+/*******************************************************************/
+static uint32_t _UNA_TRACE_get_percentile(UNA_trace_histogram_t* histogram, uint8_t percentile) {
+    // Local variables.
+    uint64_t rank = ((((uint64_t) histogram->count) * percentile) + 99) / 100;
+    uint64_t cumulative_count = 0;
+    uint32_t bucket_bound = 0;
+    uint8_t idx = 0;
+    // Search the bucket of the requested rank.
+    for (idx = 0; idx < UNA_TRACE_HISTOGRAM_BUCKET_NUMBER; idx++) {
+        cumulative_count += histogram->bucket[idx];
+        if ((cumulative_count >= rank) && (cumulative_count != 0)) {
+            break;
+        }
+    }
+    bucket_bound = (idx == 0) ? 0 : ((idx >= 32) ? 0xFFFFFFFF : ((0b1UL << idx) - 1));
+    return ((bucket_bound < histogram->max) ? bucket_bound : histogram->max);
+}
+
+/*******************************************************************/
+static void _UNA_TRACE_summarize(UNA_trace_histogram_t* histogram, UNA_trace_summary_t* summary) {
+    summary->count = histogram->count;
+    summary->p50 = _UNA_TRACE_get_percentile(histogram, 50);
+    summary->p99 = _UNA_TRACE_get_percentile(histogram, 99);
+    summary->max = histogram->max;
+}
+
+/*** UNA TRACE functions ***/
+
+/*******************************************************************/
+UNA_TRACE_status_t UNA_TRACE_init(UNA_TRACE_get_timestamp_cb_t get_timestamp, UNA_trace_histogram_t* histogram_table, UNA_trace_histogram_t* node_histogram_table) {
+    // Local variables.
+    UNA_TRACE_status_t status = UNA_TRACE_SUCCESS;
+    // Check parameters.
+    if ((get_timestamp == NULL) || (histogram_table == NULL)) {
+        status = UNA_TRACE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    una_trace_ctx.get_timestamp = get_timestamp;
+    una_trace_ctx.histogram_table = histogram_table;
+    una_trace_ctx.node_histogram_table = node_histogram_table;
+    UNA_TRACE_reset();
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void UNA_TRACE_reset(void) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Check context.
+    if (una_trace_ctx.histogram_table == NULL) {
+        return;
+    }
+    for (idx = 0; idx < UNA_TRACE_STAGE_LAST; idx++) {
+        _UNA_TRACE_clear(&(una_trace_ctx.histogram_table[idx]));
+    }
+    if (una_trace_ctx.node_histogram_table != NULL) {
+        for (idx = 0; idx < (UNA_NODE_ADDRESS_LAST * UNA_TRACE_STAGE_LAST); idx++) {
+            _UNA_TRACE_clear(&(una_trace_ctx.node_histogram_table[idx]));
+        }
+    }
+}
+
+/*******************************************************************/
+uint32_t UNA_TRACE_get_timestamp(void) {
+    return ((una_trace_ctx.get_timestamp == NULL) ? 0 : una_trace_ctx.get_timestamp());
+}
+
+/*******************************************************************/
+void UNA_TRACE_record(UNA_trace_stage_t stage, UNA_node_address_t node_addr, uint32_t start_timestamp) {
+    // Local variables.
+    uint32_t duration = 0;
+    uint8_t bucket_index = 0;
+    // Check parameters.
+    if ((una_trace_ctx.get_timestamp == NULL) || (stage >= UNA_TRACE_STAGE_LAST)) {
+        return;
+    }
+    duration = (una_trace_ctx.get_timestamp() - start_timestamp);
+    bucket_index = (duration == 0) ? 0 : (uint8_t) (32 - __builtin_clz(duration));
+    _UNA_TRACE_add(&(una_trace_ctx.histogram_table[stage]), bucket_index, duration);
+    if ((una_trace_ctx.node_histogram_table != NULL) && (node_addr < UNA_NODE_ADDRESS_LAST)) {
+        _UNA_TRACE_add(&(una_trace_ctx.node_histogram_table[(node_addr * UNA_TRACE_STAGE_LAST) + stage]), bucket_index, duration);
+    }
+}
+
+/*******************************************************************/
+UNA_TRACE_status_t UNA_TRACE_get_summary(UNA_trace_stage_t stage, UNA_trace_summary_t* summary) {
+    // Local variables.
+    UNA_TRACE_status_t status = UNA_TRACE_SUCCESS;
+    // Check parameters.
+    if ((summary == NULL) || (una_trace_ctx.histogram_table == NULL)) {
+        status = UNA_TRACE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (stage >= UNA_TRACE_STAGE_LAST) {
+        status = UNA_TRACE_ERROR_STAGE;
+        goto errors;
+    }
+    _UNA_TRACE_summarize(&(una_trace_ctx.histogram_table[stage]), summary);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+UNA_TRACE_status_t UNA_TRACE_get_node_summary(UNA_node_address_t node_addr, UNA_trace_stage_t stage, UNA_trace_summary_t* summary) {
+    // Local variables.
+    UNA_TRACE_status_t status = UNA_TRACE_SUCCESS;
+    // Check parameters.
+    if ((summary == NULL) || (una_trace_ctx.node_histogram_table == NULL)) {
+        status = UNA_TRACE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (node_addr >= UNA_NODE_ADDRESS_LAST) {
+        status = UNA_TRACE_ERROR_NODE_ADDRESS;
+        goto errors;
+    }
+    if (stage >= UNA_TRACE_STAGE_LAST) {
+        status = UNA_TRACE_ERROR_STAGE;
+        goto errors;
+    }
+    _UNA_TRACE_summarize(&(una_trace_ctx.node_histogram_table[(node_addr * UNA_TRACE_STAGE_LAST) + stage]), summary);
+errors:
+    return status;
+}
+
+#endif /* UNA_LIB_USE_TRACE */
+
+#endif /* UNA_LIB_DISABLE */
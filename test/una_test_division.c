@@ -0,0 +1,92 @@
+/*
+ * una_test_division.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "una.h"
+#include "una_reference.h"
+#include "types.h"
+
+/*** TEST local macros ***/
+
+#define TEST_CHUNK_SIZE             (0b1 << 16)
+#define TEST_ERROR_PRINT_MAX        8
+
+/*** TEST local structures ***/
+
+/*******************************************************************/
+typedef void (*TEST_convert_batch_t)(const int32_t* physical_data, uint32_t* una_representation, uint32_t size);
+
+/*******************************************************************/
+typedef struct {
+    const char_t* name;
+    UNA_convert_physical_data_t convert;
+    TEST_convert_batch_t convert_batch;
+    UNA_convert_physical_data_t convert_reference;
+} TEST_codec_t;
+
+/*** TEST local global variables ***/
+
+// Encoders which have a division-free implementation.
+static const TEST_codec_t TEST_CODEC[] = {
+    { "seconds", &UNA_convert_seconds, &UNA_convert_seconds_batch, &UNA_REFERENCE_convert_seconds },
+    { "mv", &UNA_convert_mv, &UNA_convert_mv_batch, &UNA_REFERENCE_convert_mv },
+    { "ua", &UNA_convert_ua, &UNA_convert_ua_batch, &UNA_REFERENCE_convert_ua },
+    { "mw_mva", &UNA_convert_mw_mva, &UNA_convert_mw_mva_batch, &UNA_REFERENCE_convert_mw_mva },
+    { "mwh_mvah", &UNA_convert_mwh_mvah, &UNA_convert_mwh_mvah_batch, &UNA_REFERENCE_convert_mwh_mvah },
+};
+
+static int32_t test_physical_data[TEST_CHUNK_SIZE];
+static uint32_t test_una_representation[TEST_CHUNK_SIZE];
+
+/*** TEST local functions ***/
+
+/*******************************************************************/
+static uint32_t _TEST_run_codec(const TEST_codec_t* codec) {
+    // Local variables.
+    uint32_t error_count = 0;
+    uint32_t reference = 0;
+    uint64_t physical_data = 0;
+    uint32_t idx = 0;
+    // Every int32_t input, against the frozen chained divisions of the original encoders.
+    for (physical_data = 0; physical_data <= UINT32_MAX; physical_data += TEST_CHUNK_SIZE) {
+        for (idx = 0; idx < TEST_CHUNK_SIZE; idx++) {
+            test_physical_data[idx] = (int32_t) (uint32_t) (physical_data + idx);
+        }
+        (codec->convert_batch)(test_physical_data, test_una_representation, TEST_CHUNK_SIZE);
+        for (idx = 0; idx < TEST_CHUNK_SIZE; idx++) {
+            reference = (codec->convert_reference)(test_physical_data[idx]);
+            if (((codec->convert)(test_physical_data[idx]) != reference) || (test_una_representation[idx] != reference)) {
+                if (error_count < TEST_ERROR_PRINT_MAX) {
+                    printf("%s: value %d encoded to %08X (batch %08X), expected %08X\n", codec->name, test_physical_data[idx], (codec->convert)(test_physical_data[idx]), test_una_representation[idx], reference);
+                }
+                error_count++;
+            }
+        }
+    }
+    return error_count;
+}
+
+/*** TEST functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    uint32_t error_count = 0;
+    uint32_t idx = 0;
+    // Run all cases.
+    for (idx = 0; idx < (sizeof(TEST_CODEC) / sizeof(TEST_codec_t)); idx++) {
+        error_count += _TEST_run_codec(&(TEST_CODEC[idx]));
+    }
+#ifdef UNA_LIB_USE_DIVISION_FREE
+    printf("Division-free encoders test: %s (%u errors)\n", ((error_count == 0) ? "PASSED" : "FAILED"), error_count);
+#else
+    printf("Division encoders test: %s (%u errors)\n", ((error_count == 0) ? "PASSED" : "FAILED"), error_count);
+#endif
+    return ((error_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
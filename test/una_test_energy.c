@@ -0,0 +1,122 @@
+/*
+ * una_test_energy.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "una.h"
+#include "una_energy.h"
+#include "types.h"
+
+/*** TEST local macros ***/
+
+#define TEST_CHANNEL_NUMBER     1
+#define TEST_GROUP_NUMBER       1
+
+/*** TEST local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    int32_t start_mwh_mvah;
+    int32_t end_mwh_mvah;
+    int32_t step_mwh_mvah;
+} TEST_ramp_t;
+
+/*** TEST local global variables ***/
+
+// Ramps crossing each unit boundary of the electrical energy representation, in both signs.
+static const TEST_ramp_t TEST_RAMP[] = {
+    { 8000, 8400, 5 },
+    { 810000, 830000, 50 },
+    { 8100000, 8300000, 500 },
+    { -8000, -8400, -5 },
+    { -810000, -830000, -50 },
+    { -8100000, -8300000, -500 },
+};
+
+/*** TEST local functions ***/
+
+/*******************************************************************/
+static uint32_t _TEST_run_ramp(const TEST_ramp_t* ramp) {
+    // Local variables.
+    UNA_energy_t accumulator;
+    UNA_energy_channel_t channel_table[TEST_CHANNEL_NUMBER];
+    int64_t group_total_table[TEST_GROUP_NUMBER];
+    int64_t total_mwh_mvah = 0;
+    int64_t expected_mwh_mvah = 0;
+    uint32_t reset_count = 0;
+    uint32_t una_electrical_energy = 0;
+    int32_t first_mwh_mvah = 0;
+    int32_t extremum_mwh_mvah = 0;
+    int32_t reading_mwh_mvah = 0;
+    int32_t meter_mwh_mvah = 0;
+    // Meter counter increasing in magnitude, read through its UNA representation.
+    if (UNA_ENERGY_init(&accumulator, channel_table, TEST_CHANNEL_NUMBER, group_total_table, TEST_GROUP_NUMBER) != UNA_ENERGY_SUCCESS) {
+        return 1;
+    }
+    UNA_ENERGY_set_group(&accumulator, 0, 0);
+    first_mwh_mvah = UNA_get_mwh_mvah(UNA_convert_mwh_mvah(ramp->start_mwh_mvah));
+    extremum_mwh_mvah = first_mwh_mvah;
+    for (meter_mwh_mvah = ramp->start_mwh_mvah; ((ramp->step_mwh_mvah > 0) ? (meter_mwh_mvah <= ramp->end_mwh_mvah) : (meter_mwh_mvah >= ramp->end_mwh_mvah)); meter_mwh_mvah += ramp->step_mwh_mvah) {
+        una_electrical_energy = UNA_convert_mwh_mvah(meter_mwh_mvah);
+        UNA_ENERGY_ingest_batch(&accumulator, 0, &una_electrical_energy, 1);
+        reading_mwh_mvah = UNA_get_mwh_mvah(una_electrical_energy);
+        if (((ramp->step_mwh_mvah > 0) && (reading_mwh_mvah > extremum_mwh_mvah)) || ((ramp->step_mwh_mvah < 0) && (reading_mwh_mvah < extremum_mwh_mvah))) {
+            extremum_mwh_mvah = reading_mwh_mvah;
+        }
+    }
+    // Total is the largest reading seen minus the first one, without any reset.
+    expected_mwh_mvah = ((int64_t) extremum_mwh_mvah - (int64_t) first_mwh_mvah);
+    UNA_ENERGY_read_channel(&accumulator, 0, &total_mwh_mvah, &reset_count);
+    if ((total_mwh_mvah != expected_mwh_mvah) || (reset_count != 0) || (group_total_table[0] != expected_mwh_mvah)) {
+        printf("ramp %d to %d: total=%lld reset_count=%u, expected total=%lld reset_count=0\n", ramp->start_mwh_mvah, ramp->end_mwh_mvah, (long long) total_mwh_mvah, reset_count, (long long) expected_mwh_mvah);
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_reset(void) {
+    // Local variables.
+    UNA_energy_t accumulator;
+    UNA_energy_channel_t channel_table[TEST_CHANNEL_NUMBER];
+    const int32_t reading_mwh_mvah[] = { 819000, 820000, 100, 150, -20, -50 };
+    int64_t total_mwh_mvah = 0;
+    uint32_t reset_count = 0;
+    uint32_t una_electrical_energy = 0;
+    uint32_t idx = 0;
+    // Drop larger than the reading resolution, then sign change.
+    if (UNA_ENERGY_init(&accumulator, channel_table, TEST_CHANNEL_NUMBER, NULL, 0) != UNA_ENERGY_SUCCESS) {
+        return 1;
+    }
+    for (idx = 0; idx < (sizeof(reading_mwh_mvah) / sizeof(int32_t)); idx++) {
+        una_electrical_energy = UNA_convert_mwh_mvah(reading_mwh_mvah[idx]);
+        UNA_ENERGY_ingest_batch(&accumulator, 0, &una_electrical_energy, 1);
+    }
+    UNA_ENERGY_read_channel(&accumulator, 0, &total_mwh_mvah, &reset_count);
+    if ((total_mwh_mvah != (1000 + 100 + 50 - 20 - 30)) || (reset_count != 2)) {
+        printf("reset: total=%lld reset_count=%u, expected total=1100 reset_count=2\n", (long long) total_mwh_mvah, reset_count);
+        return 1;
+    }
+    return 0;
+}
+
+/*** TEST functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    uint32_t error_count = 0;
+    uint32_t idx = 0;
+    // Run all cases.
+    for (idx = 0; idx < (sizeof(TEST_RAMP) / sizeof(TEST_ramp_t)); idx++) {
+        error_count += _TEST_run_ramp(&(TEST_RAMP[idx]));
+    }
+    error_count += _TEST_run_reset();
+    printf("Energy accumulator test: %s (%u errors)\n", ((error_count == 0) ? "PASSED" : "FAILED"), error_count);
+    return ((error_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
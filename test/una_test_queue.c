@@ -0,0 +1,314 @@
+/*
+ * una_test_queue.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "una.h"
+#include "una_loopback.h"
+#include "una_queue.h"
+#include "types.h"
+
+/*** TEST local macros ***/
+
+#define TEST_REGISTER_NUMBER        4
+#define TEST_QUEUE_SIZE             32
+#define TEST_NODE_NUMBER            3
+#define TEST_ABSENT_NODE_ADDRESS    0x10
+#define TEST_RANDOM_QUEUE_NUMBER    2000
+
+/*** TEST local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    UNA_node_address_t node_addr;
+    uint8_t reg_addr;
+    UNA_access_type_t type;
+} TEST_access_t;
+
+/*** TEST local functions declaration ***/
+
+static void _TEST_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status);
+static void _TEST_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status);
+
+/*** TEST local global variables ***/
+
+// Loopback bus, with the order of the accesses recorded.
+static const UNA_transport_t TEST_TRANSPORT = {
+    &_TEST_read_register,
+    &_TEST_write_register
+};
+
+static uint32_t test_register_file[UNA_NODE_ADDRESS_LAST * TEST_REGISTER_NUMBER];
+static uint32_t test_model_register_file[UNA_NODE_ADDRESS_LAST * TEST_REGISTER_NUMBER];
+static TEST_access_t test_access_table[TEST_QUEUE_SIZE];
+static uint16_t test_access_count = 0;
+static uint32_t test_random_seed = 0x12345678;
+
+/*** TEST local functions ***/
+
+/*******************************************************************/
+static void _TEST_record(UNA_access_parameters_t* access_params, UNA_access_type_t type) {
+    if (test_access_count < TEST_QUEUE_SIZE) {
+        test_access_table[test_access_count].node_addr = access_params->node_addr;
+        test_access_table[test_access_count].reg_addr = access_params->reg_addr;
+        test_access_table[test_access_count].type = type;
+    }
+    test_access_count++;
+}
+
+/*******************************************************************/
+static void _TEST_read_register(UNA_access_parameters_t* read_params, uint32_t* reg_value, UNA_access_status_t* read_status) {
+    _TEST_record(read_params, UNA_ACCESS_TYPE_READ);
+    UNA_LOOPBACK_read_register(read_params, reg_value, read_status);
+}
+
+/*******************************************************************/
+static void _TEST_write_register(UNA_access_parameters_t* write_params, uint32_t reg_value, uint32_t reg_mask, UNA_access_status_t* write_status) {
+    _TEST_record(write_params, UNA_ACCESS_TYPE_WRITE);
+    UNA_LOOPBACK_write_register(write_params, reg_value, reg_mask, write_status);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_random(void) {
+    // Deterministic linear congruential generator.
+    test_random_seed = (test_random_seed * 1664525UL) + 1013904223UL;
+    return (test_random_seed >> 8);
+}
+
+/*******************************************************************/
+static void _TEST_set_transaction(UNA_transaction_t* transaction, UNA_access_type_t type, UNA_node_address_t node_addr, uint8_t reg_addr, uint32_t reg_value, uint32_t reg_mask) {
+    transaction->type = type;
+    transaction->access_params.node_addr = node_addr;
+    transaction->access_params.reg_addr = reg_addr;
+    transaction->access_params.reply_params.type = (type == UNA_ACCESS_TYPE_READ) ? UNA_REPLY_TYPE_VALUE : UNA_REPLY_TYPE_OK;
+    transaction->access_params.reply_params.timeout_ms = 0;
+    transaction->reg_value = reg_value;
+    transaction->reg_mask = reg_mask;
+    transaction->status.all = 0xFF;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_execute(UNA_transaction_t* transaction_list, uint16_t transaction_count) {
+    // Local variables.
+    UNA_transaction_t* transaction_table[TEST_QUEUE_SIZE];
+    UNA_queue_t queue;
+    uint16_t idx = 0;
+    // Fresh bus with all test nodes connected.
+    UNA_LOOPBACK_init(test_register_file, TEST_REGISTER_NUMBER);
+    for (idx = 1; idx <= TEST_NODE_NUMBER; idx++) {
+        UNA_LOOPBACK_set_node_presence((UNA_node_address_t) idx, 1);
+    }
+    test_access_count = 0;
+    if ((UNA_QUEUE_init(&queue, transaction_table, TEST_QUEUE_SIZE) != UNA_QUEUE_SUCCESS) ||
+        (UNA_QUEUE_add(&queue, transaction_list, transaction_count) != UNA_QUEUE_SUCCESS) ||
+        (UNA_QUEUE_execute(&queue, (UNA_transport_t*) &TEST_TRANSPORT) != UNA_QUEUE_SUCCESS)) {
+        printf("queue execution error\n");
+        return 1;
+    }
+    if ((queue.count != 0) || (queue.bus_access_count != test_access_count)) {
+        printf("queue: count=%u bus_access_count=%u, expected count=0 bus_access_count=%u\n", queue.count, queue.bus_access_count, test_access_count);
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_check_access(const char_t* name, uint16_t idx, UNA_node_address_t node_addr, uint8_t reg_addr, UNA_access_type_t type) {
+    if ((idx >= test_access_count) || (test_access_table[idx].node_addr != node_addr) || (test_access_table[idx].reg_addr != reg_addr) || (test_access_table[idx].type != type)) {
+        printf("%s: bus access %u is not %s of node %u register %u\n", name, idx, ((type == UNA_ACCESS_TYPE_READ) ? "read" : "write"), node_addr, reg_addr);
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_check_read(const char_t* name, UNA_transaction_t* transaction, uint32_t reg_value) {
+    if ((transaction->reg_value != reg_value) || (transaction->status.flags != 0) || (transaction->status.type != UNA_ACCESS_TYPE_READ)) {
+        printf("%s: read value=%08X status=%02X, expected value=%08X without error\n", name, transaction->reg_value, transaction->status.all, reg_value);
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_check_write(const char_t* name, UNA_transaction_t* transaction) {
+    if ((transaction->status.flags != 0) || (transaction->status.type != UNA_ACCESS_TYPE_WRITE)) {
+        printf("%s: write status=%02X, expected no error\n", name, transaction->status.all);
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_duplicate_reads(void) {
+    // Local variables.
+    UNA_transaction_t transaction_list[4];
+    uint32_t error_count = 0;
+    uint16_t idx = 0;
+    // Reads of the same register are performed once, until it is written.
+    _TEST_set_transaction(&(transaction_list[0]), UNA_ACCESS_TYPE_READ, 1, 0, 0, 0);
+    _TEST_set_transaction(&(transaction_list[1]), UNA_ACCESS_TYPE_READ, 1, 0, 0, 0);
+    _TEST_set_transaction(&(transaction_list[2]), UNA_ACCESS_TYPE_WRITE, 1, 0, 0x1234, 0xFFFFFFFF);
+    _TEST_set_transaction(&(transaction_list[3]), UNA_ACCESS_TYPE_READ, 1, 0, 0, 0);
+    error_count += _TEST_execute(transaction_list, 4);
+    error_count += _TEST_check_access("duplicate reads", 0, 1, 0, UNA_ACCESS_TYPE_READ);
+    error_count += _TEST_check_access("duplicate reads", 1, 1, 0, UNA_ACCESS_TYPE_WRITE);
+    error_count += _TEST_check_access("duplicate reads", 2, 1, 0, UNA_ACCESS_TYPE_READ);
+    for (idx = 0; idx < 2; idx++) {
+        error_count += _TEST_check_read("duplicate reads", &(transaction_list[idx]), 0);
+    }
+    error_count += _TEST_check_write("duplicate reads", &(transaction_list[2]));
+    error_count += _TEST_check_read("duplicate reads", &(transaction_list[3]), 0x1234);
+    if (test_access_count != 3) {
+        printf("duplicate reads: %u bus accesses, expected 3\n", test_access_count);
+        error_count++;
+    }
+    return error_count;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_merged_writes(void) {
+    // Local variables.
+    UNA_transaction_t transaction_list[5];
+    uint32_t error_count = 0;
+    uint16_t idx = 0;
+    // Writes of the same register are merged with their masks, until it is read.
+    _TEST_set_transaction(&(transaction_list[0]), UNA_ACCESS_TYPE_WRITE, 2, 1, 0x0000000F, 0x0000000F);
+    _TEST_set_transaction(&(transaction_list[1]), UNA_ACCESS_TYPE_WRITE, 2, 1, 0x000000F0, 0x000000F0);
+    _TEST_set_transaction(&(transaction_list[2]), UNA_ACCESS_TYPE_WRITE, 2, 1, 0x00000001, 0x0000000F);
+    _TEST_set_transaction(&(transaction_list[3]), UNA_ACCESS_TYPE_READ, 2, 1, 0, 0);
+    _TEST_set_transaction(&(transaction_list[4]), UNA_ACCESS_TYPE_WRITE, 2, 1, 0x00000F00, 0x00000F00);
+    error_count += _TEST_execute(transaction_list, 5);
+    error_count += _TEST_check_access("merged writes", 0, 2, 1, UNA_ACCESS_TYPE_WRITE);
+    error_count += _TEST_check_access("merged writes", 1, 2, 1, UNA_ACCESS_TYPE_READ);
+    error_count += _TEST_check_access("merged writes", 2, 2, 1, UNA_ACCESS_TYPE_WRITE);
+    for (idx = 0; idx < 3; idx++) {
+        error_count += _TEST_check_write("merged writes", &(transaction_list[idx]));
+    }
+    error_count += _TEST_check_read("merged writes", &(transaction_list[3]), 0x000000F1);
+    error_count += _TEST_check_write("merged writes", &(transaction_list[4]));
+    if ((test_access_count != 3) || (test_register_file[(2 * TEST_REGISTER_NUMBER) + 1] != 0x00000FF1)) {
+        printf("merged writes: %u bus accesses and register=%08X, expected 3 and 00000FF1\n", test_access_count, test_register_file[(2 * TEST_REGISTER_NUMBER) + 1]);
+        error_count++;
+    }
+    return error_count;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_node_grouping(void) {
+    // Local variables.
+    UNA_transaction_t transaction_list[6];
+    uint32_t error_count = 0;
+    // Accesses are grouped by node address, in their submission order within each node.
+    _TEST_set_transaction(&(transaction_list[0]), UNA_ACCESS_TYPE_WRITE, 3, 2, 0x33, 0xFF);
+    _TEST_set_transaction(&(transaction_list[1]), UNA_ACCESS_TYPE_READ, 1, 3, 0, 0);
+    _TEST_set_transaction(&(transaction_list[2]), UNA_ACCESS_TYPE_READ, 3, 2, 0, 0);
+    _TEST_set_transaction(&(transaction_list[3]), UNA_ACCESS_TYPE_WRITE, 1, 3, 0x11, 0xFF);
+    _TEST_set_transaction(&(transaction_list[4]), UNA_ACCESS_TYPE_READ, 3, 0, 0, 0);
+    _TEST_set_transaction(&(transaction_list[5]), UNA_ACCESS_TYPE_READ, 1, 3, 0, 0);
+    error_count += _TEST_execute(transaction_list, 6);
+    error_count += _TEST_check_access("node grouping", 0, 1, 3, UNA_ACCESS_TYPE_READ);
+    error_count += _TEST_check_access("node grouping", 1, 1, 3, UNA_ACCESS_TYPE_WRITE);
+    error_count += _TEST_check_access("node grouping", 2, 1, 3, UNA_ACCESS_TYPE_READ);
+    error_count += _TEST_check_access("node grouping", 3, 3, 2, UNA_ACCESS_TYPE_WRITE);
+    error_count += _TEST_check_access("node grouping", 4, 3, 2, UNA_ACCESS_TYPE_READ);
+    error_count += _TEST_check_access("node grouping", 5, 3, 0, UNA_ACCESS_TYPE_READ);
+    error_count += _TEST_check_read("node grouping", &(transaction_list[1]), 0);
+    error_count += _TEST_check_read("node grouping", &(transaction_list[2]), 0x33);
+    error_count += _TEST_check_read("node grouping", &(transaction_list[5]), 0x11);
+    return error_count;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_absent_node(void) {
+    // Local variables.
+    UNA_transaction_t transaction_list[3];
+    uint32_t error_count = 0;
+    uint16_t idx = 0;
+    // Each coalesced transaction receives the status of the bus access.
+    _TEST_set_transaction(&(transaction_list[0]), UNA_ACCESS_TYPE_READ, TEST_ABSENT_NODE_ADDRESS, 0, 0, 0);
+    _TEST_set_transaction(&(transaction_list[1]), UNA_ACCESS_TYPE_READ, TEST_ABSENT_NODE_ADDRESS, 0, 0, 0);
+    _TEST_set_transaction(&(transaction_list[2]), UNA_ACCESS_TYPE_READ, TEST_ABSENT_NODE_ADDRESS, 0, 0, 0);
+    error_count += _TEST_execute(transaction_list, 3);
+    for (idx = 0; idx < 3; idx++) {
+        if ((transaction_list[idx].status.reply_timeout == 0) || (transaction_list[idx].status.type != UNA_ACCESS_TYPE_READ)) {
+            printf("absent node: transaction %u status=%02X, expected reply timeout\n", idx, transaction_list[idx].status.all);
+            error_count++;
+        }
+    }
+    if (test_access_count != 1) {
+        printf("absent node: %u bus accesses, expected 1\n", test_access_count);
+        error_count++;
+    }
+    return error_count;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_random(void) {
+    // Local variables.
+    UNA_transaction_t transaction_list[TEST_QUEUE_SIZE];
+    uint32_t expected_value[TEST_QUEUE_SIZE];
+    uint32_t* model_register = NULL;
+    uint32_t error_count = 0;
+    uint32_t queue_idx = 0;
+    uint16_t transaction_count = 0;
+    uint16_t idx = 0;
+    // Coalesced execution must give the results of the transactions executed one by one in submission order.
+    for (queue_idx = 0; (queue_idx < TEST_RANDOM_QUEUE_NUMBER) && (error_count == 0); queue_idx++) {
+        for (idx = 0; idx < (UNA_NODE_ADDRESS_LAST * TEST_REGISTER_NUMBER); idx++) {
+            test_model_register_file[idx] = 0;
+        }
+        transaction_count = (uint16_t) ((_TEST_random() % TEST_QUEUE_SIZE) + 1);
+        for (idx = 0; idx < transaction_count; idx++) {
+            _TEST_set_transaction(&(transaction_list[idx]), (UNA_access_type_t) (_TEST_random() & 0b1), (UNA_node_address_t) ((_TEST_random() % TEST_NODE_NUMBER) + 1), (uint8_t) (_TEST_random() % 2), _TEST_random(), (0xFFUL << (8 * (_TEST_random() % 4))));
+            model_register = &(test_model_register_file[(transaction_list[idx].access_params.node_addr * TEST_REGISTER_NUMBER) + transaction_list[idx].access_params.reg_addr]);
+            if (transaction_list[idx].type == UNA_ACCESS_TYPE_READ) {
+                expected_value[idx] = (*model_register);
+            }
+            else {
+                (*model_register) = ((*model_register) & (~transaction_list[idx].reg_mask)) | (transaction_list[idx].reg_value & transaction_list[idx].reg_mask);
+            }
+        }
+        error_count += _TEST_execute(transaction_list, transaction_count);
+        for (idx = 0; idx < transaction_count; idx++) {
+            if (transaction_list[idx].type == UNA_ACCESS_TYPE_READ) {
+                error_count += _TEST_check_read("random", &(transaction_list[idx]), expected_value[idx]);
+            }
+            else {
+                error_count += _TEST_check_write("random", &(transaction_list[idx]));
+            }
+        }
+        for (idx = 0; idx < (UNA_NODE_ADDRESS_LAST * TEST_REGISTER_NUMBER); idx++) {
+            if (test_register_file[idx] != test_model_register_file[idx]) {
+                printf("random: register %u=%08X, expected %08X\n", idx, test_register_file[idx], test_model_register_file[idx]);
+                error_count++;
+            }
+        }
+        if (test_access_count > transaction_count) {
+            printf("random: %u bus accesses for %u transactions\n", test_access_count, transaction_count);
+            error_count++;
+        }
+    }
+    return error_count;
+}
+
+/*** TEST functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    uint32_t error_count = 0;
+    // Run all cases.
+    error_count += _TEST_run_duplicate_reads();
+    error_count += _TEST_run_merged_writes();
+    error_count += _TEST_run_node_grouping();
+    error_count += _TEST_run_absent_node();
+    error_count += _TEST_run_random();
+    printf("Register access queue test: %s (%u errors)\n", ((error_count == 0) ? "PASSED" : "FAILED"), error_count);
+    return ((error_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,209 @@
+/*
+ * una_test_reply.c
+ *
+ *  Created on: 17 oct. 2026
+ *      Author: Ludo
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "una.h"
+#include "una_frame.h"
+#include "una_reply.h"
+#include "types.h"
+
+/*** TEST local macros ***/
+
+#define TEST_NODE_ADDRESS           0x05
+#define TEST_OTHER_NODE_ADDRESS     0x06
+
+#define TEST_STREAM_SIZE_MAX_BYTES  96
+#define TEST_RANDOM_STREAM_NUMBER   20000
+
+#define TEST_MASTER                 (UNA_FRAME_ADDRESS_MARKER | UNA_NODE_ADDRESS_MASTER)
+#define TEST_NODE                   (UNA_FRAME_ADDRESS_MARKER | TEST_NODE_ADDRESS)
+#define TEST_END                    UNA_FRAME_END_CHAR
+
+/*** TEST local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char_t* name;
+    UNA_access_type_t access_type;
+    UNA_reply_type_t reply_type;
+    uint8_t stream[TEST_STREAM_SIZE_MAX_BYTES];
+    uint32_t size;
+    uint32_t consumed;
+    uint8_t complete;
+    uint32_t reg_value;
+    uint8_t parser_error;
+    uint8_t error_received;
+} TEST_stream_t;
+
+/*** TEST local global variables ***/
+
+// Each stream is a sequence of frames seen on the bus: "destination, source, payload, end" with the address marker on the first byte.
+static const TEST_stream_t TEST_STREAM[] = {
+    { "value", UNA_ACCESS_TYPE_READ, UNA_REPLY_TYPE_VALUE,
+      { TEST_MASTER, TEST_NODE_ADDRESS, '1', '2', 'a', 'B', TEST_END }, 7, 7, 1, 0x12AB, 0, 0 },
+    { "echo and noise", UNA_ACCESS_TYPE_READ, UNA_REPLY_TYPE_VALUE,
+      { TEST_NODE, UNA_NODE_ADDRESS_MASTER, 'R', '0', '1', TEST_END, 'n', 'o', 'i', 's', 'e', ' ', 'b', 'e', 't', 'w', 'e', 'e', 'n', ' ', 'f', 'r', 'a', 'm', 'e', 's',
+        TEST_MASTER, TEST_NODE_ADDRESS, 'F', 'F', 'F', 'F', 'F', 'F', 'F', 'F', TEST_END }, 37, 37, 1, 0xFFFFFFFF, 0, 0 },
+    { "ok", UNA_ACCESS_TYPE_WRITE, UNA_REPLY_TYPE_OK,
+      { TEST_MASTER, TEST_NODE_ADDRESS, 'O', 'K', TEST_END }, 5, 5, 1, 0, 0, 0 },
+    { "error", UNA_ACCESS_TYPE_READ, UNA_REPLY_TYPE_VALUE,
+      { TEST_MASTER, TEST_NODE_ADDRESS, 'E', 'R', 'R', 'O', 'R', '1', '2', TEST_END }, 10, 10, 1, 0, 0, 1 },
+    { "late reply of another node", UNA_ACCESS_TYPE_READ, UNA_REPLY_TYPE_VALUE,
+      { TEST_MASTER, TEST_OTHER_NODE_ADDRESS, '9', '9', TEST_END, TEST_MASTER, TEST_NODE_ADDRESS, '4', '2', TEST_END }, 10, 10, 1, 0x42, 0, 0 },
+    { "truncated", UNA_ACCESS_TYPE_READ, UNA_REPLY_TYPE_VALUE,
+      { TEST_MASTER, TEST_NODE_ADDRESS, '4', '2', TEST_MASTER, TEST_NODE_ADDRESS, '4', '2', TEST_END }, 9, 5, 1, 0, 1, 0 },
+    { "too many digits", UNA_ACCESS_TYPE_READ, UNA_REPLY_TYPE_VALUE,
+      { TEST_MASTER, TEST_NODE_ADDRESS, '1', '2', '3', '4', '5', '6', '7', '8', '9', TEST_END }, 12, 12, 1, 0, 1, 0 },
+    { "unexpected reply type", UNA_ACCESS_TYPE_WRITE, UNA_REPLY_TYPE_OK,
+      { TEST_MASTER, TEST_NODE_ADDRESS, '4', '2', TEST_END }, 5, 5, 1, 0, 1, 0 },
+    { "next frame after the reply", UNA_ACCESS_TYPE_READ, UNA_REPLY_TYPE_VALUE,
+      { TEST_MASTER, TEST_NODE_ADDRESS, '7', TEST_END, TEST_NODE, UNA_NODE_ADDRESS_MASTER, 'R', '0', '2', TEST_END }, 10, 4, 1, 0x7, 0, 0 },
+    { "incomplete", UNA_ACCESS_TYPE_READ, UNA_REPLY_TYPE_VALUE,
+      { TEST_MASTER, TEST_NODE_ADDRESS, '1', '2' }, 4, 4, 0, 0x12, 0, 0 },
+};
+
+// Random streams are built from the bytes which drive the parser state machine.
+static const uint8_t TEST_ALPHABET[] = { TEST_MASTER, TEST_NODE, UNA_NODE_ADDRESS_MASTER, TEST_NODE_ADDRESS, TEST_OTHER_NODE_ADDRESS, TEST_END, 'O', 'K', 'E', 'R', '0', '1', 'a', 'f', 'z', ' ' };
+
+static uint32_t test_random_seed = 0x12345678;
+
+/*** TEST local functions ***/
+
+/*******************************************************************/
+static uint32_t _TEST_random(void) {
+    // Deterministic linear congruential generator.
+    test_random_seed = (test_random_seed * 1664525UL) + 1013904223UL;
+    return (test_random_seed >> 8);
+}
+
+/*******************************************************************/
+static uint32_t _TEST_parse_bytes(UNA_reply_parser_t* parser, const uint8_t* stream, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Reference path: one byte at a time, as from the UART interrupt.
+    for (idx = 0; idx < size; idx++) {
+        if (UNA_REPLY_parse_byte(parser, stream[idx]) != 0) {
+            return (idx + 1);
+        }
+    }
+    return size;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_parse_chunks(UNA_reply_parser_t* parser, const uint8_t* stream, uint32_t size, uint32_t chunk_size) {
+    // Local variables.
+    uint8_t buffer[TEST_STREAM_SIZE_MAX_BYTES];
+    uint32_t consumed = 0;
+    uint32_t parsed = 0;
+    uint32_t idx = 0;
+    // Buffer path: chunks are copied so that a read past their end would be visible to sanitizers.
+    while ((idx < size) && (UNA_REPLY_is_complete(parser) == 0)) {
+        parsed = ((size - idx) < chunk_size) ? (size - idx) : chunk_size;
+        __builtin_memcpy(buffer, &(stream[idx]), parsed);
+        consumed += UNA_REPLY_parse_buffer(parser, buffer, parsed);
+        idx += parsed;
+    }
+    return consumed;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_compare(const char_t* name, const uint8_t* stream, uint32_t size, UNA_access_type_t access_type, UNA_reply_type_t reply_type, UNA_reply_parser_t* reference, uint32_t* reference_consumed) {
+    // Local variables.
+    UNA_access_parameters_t access_params;
+    UNA_reply_parser_t parser;
+    uint32_t consumed = 0;
+    uint32_t chunk_size = 0;
+    uint32_t error_count = 0;
+    // Byte path is the reference.
+    access_params.node_addr = TEST_NODE_ADDRESS;
+    access_params.reg_addr = 0;
+    access_params.reply_params.type = reply_type;
+    access_params.reply_params.timeout_ms = 0;
+    UNA_REPLY_start(reference, access_type, &access_params);
+    (*reference_consumed) = _TEST_parse_bytes(reference, stream, size);
+    // Buffer path must reach the same state whatever the chunk size.
+    for (chunk_size = 1; chunk_size <= size; chunk_size++) {
+        UNA_REPLY_start(&parser, access_type, &access_params);
+        consumed = _TEST_parse_chunks(&parser, stream, size, chunk_size);
+        if ((consumed != (*reference_consumed)) || (parser.state != reference->state) || (parser.index != reference->index) || (parser.reg_value != reference->reg_value) || (parser.access_status.all != reference->access_status.all)) {
+            printf("%s (chunk %u): consumed=%u state=%u value=%08X status=%02X, expected consumed=%u state=%u value=%08X status=%02X\n", name, chunk_size,
+                consumed, parser.state, parser.reg_value, parser.access_status.all,
+                (*reference_consumed), reference->state, reference->reg_value, reference->access_status.all);
+            error_count++;
+            break;
+        }
+    }
+    return error_count;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_stream(const TEST_stream_t* stream) {
+    // Local variables.
+    UNA_reply_parser_t reference;
+    UNA_access_status_t access_status;
+    uint32_t reference_consumed = 0;
+    uint32_t reg_value = 0;
+    uint32_t error_count = 0;
+    // Both paths agree.
+    error_count += _TEST_compare(stream->name, stream->stream, stream->size, stream->access_type, stream->reply_type, &reference, &reference_consumed);
+    // And decode the expected result.
+    if (UNA_REPLY_is_complete(&reference) != stream->complete) {
+        printf("%s: complete=%u, expected %u\n", stream->name, UNA_REPLY_is_complete(&reference), stream->complete);
+        return (error_count + 1);
+    }
+    UNA_REPLY_get_access_status(&reference, &access_status);
+    reg_value = reference.reg_value;
+    if (stream->complete != 0) {
+        UNA_REPLY_get_result(&reference, &reg_value, &access_status);
+    }
+    if ((reference_consumed != stream->consumed) || (reg_value != stream->reg_value) || (access_status.parser_error != stream->parser_error) || (access_status.error_received != stream->error_received)) {
+        printf("%s: consumed=%u value=%08X parser_error=%u error_received=%u, expected consumed=%u value=%08X parser_error=%u error_received=%u\n", stream->name,
+            reference_consumed, reg_value, access_status.parser_error, access_status.error_received,
+            stream->consumed, stream->reg_value, stream->parser_error, stream->error_received);
+        error_count++;
+    }
+    return error_count;
+}
+
+/*******************************************************************/
+static uint32_t _TEST_run_random(void) {
+    // Local variables.
+    UNA_reply_parser_t reference;
+    uint8_t stream[TEST_STREAM_SIZE_MAX_BYTES];
+    uint32_t reference_consumed = 0;
+    uint32_t size = 0;
+    uint32_t error_count = 0;
+    uint32_t stream_idx = 0;
+    uint32_t idx = 0;
+    // Random frames mixing valid and invalid replies, to both reply types.
+    for (stream_idx = 0; (stream_idx < TEST_RANDOM_STREAM_NUMBER) && (error_count == 0); stream_idx++) {
+        size = (_TEST_random() % TEST_STREAM_SIZE_MAX_BYTES) + 1;
+        for (idx = 0; idx < size; idx++) {
+            stream[idx] = TEST_ALPHABET[_TEST_random() % sizeof(TEST_ALPHABET)];
+        }
+        error_count += _TEST_compare("random", stream, size, (UNA_access_type_t) (stream_idx & 0b1), ((stream_idx & 0b1) != 0) ? UNA_REPLY_TYPE_OK : UNA_REPLY_TYPE_VALUE, &reference, &reference_consumed);
+    }
+    return error_count;
+}
+
+/*** TEST functions ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    uint32_t error_count = 0;
+    uint32_t idx = 0;
+    // Run all cases.
+    for (idx = 0; idx < (sizeof(TEST_STREAM) / sizeof(TEST_stream_t)); idx++) {
+        error_count += _TEST_run_stream(&(TEST_STREAM[idx]));
+    }
+    error_count += _TEST_run_random();
+    printf("Reply parser test: %s (%u errors)\n", ((error_count == 0) ? "PASSED" : "FAILED"), error_count);
+    return ((error_count == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
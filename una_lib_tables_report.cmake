@@ -0,0 +1,24 @@
+#
+# una_lib_tables_report.cmake
+#
+#  Created on: 17 oct. 2026
+#      Author: Ludo
+#
+
+# Print the ROM cost of each constant table of the archive.
+# Usage: cmake -DNM=<nm_path> -DARCHIVE=<archive_path> -P una_lib_tables_report.cmake
+execute_process(
+    COMMAND ${NM} --print-size --size-sort --radix=d ${ARCHIVE}
+    OUTPUT_VARIABLE NM_OUTPUT
+    ERROR_QUIET
+)
+string(REPLACE "\n" ";" NM_LINE_LIST "${NM_OUTPUT}")
+set(TABLES_SIZE 0)
+foreach(NM_LINE ${NM_LINE_LIST})
+    if(NM_LINE MATCHES "^[0-9]+ ([0-9]+) [rR] (UNA_[A-Z0-9_]*TABLE)$")
+        math(EXPR TABLE_SIZE "${CMAKE_MATCH_1}")
+        math(EXPR TABLES_SIZE "${TABLES_SIZE} + ${TABLE_SIZE}")
+        message("${CMAKE_MATCH_2}: ${TABLE_SIZE} bytes")
+    endif()
+endforeach()
+message("Constant tables ROM cost: ${TABLES_SIZE} bytes")